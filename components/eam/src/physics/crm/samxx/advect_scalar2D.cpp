@@ -17,13 +17,14 @@ void advect_scalar2D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j        = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  workspace_frame ws;
+  real4d mx    = ws.get<4>("mx"   ,nzm,1,nx+2,ncrms);
+  real4d mn    = ws.get<4>("mn"   ,nzm,1,nx+2,ncrms);
+  real4d uuu   = ws.get<4>("uuu"  ,nzm,1,nx+5,ncrms);
+  real4d www   = ws.get<4>("www"  ,nz,1,nx+4,ncrms);
+  real2d iadz  = ws.get<2>("iadz" ,nzm,ncrms);
+  real2d irho  = ws.get<2>("irho" ,nzm,ncrms);
+  real2d irhow = ws.get<2>("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -212,13 +213,14 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  workspace_frame ws;
+  real4d mx    = ws.get<4>("mx"   ,nzm,1,nx+2,ncrms);
+  real4d mn    = ws.get<4>("mn"   ,nzm,1,nx+2,ncrms);
+  real4d uuu   = ws.get<4>("uuu"  ,nzm,1,nx+5,ncrms);
+  real4d www   = ws.get<4>("www"  ,nz,1,nx+4,ncrms);
+  real2d iadz  = ws.get<2>("iadz" ,nzm,ncrms);
+  real2d irho  = ws.get<2>("irho" ,nzm,ncrms);
+  real2d irhow = ws.get<2>("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -408,13 +410,14 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  workspace_frame ws;
+  real4d mx    = ws.get<4>("mx"   ,nzm,1,nx+2,ncrms);
+  real4d mn    = ws.get<4>("mn"   ,nzm,1,nx+2,ncrms);
+  real4d uuu   = ws.get<4>("uuu"  ,nzm,1,nx+5,ncrms);
+  real4d www   = ws.get<4>("www"  ,nz,1,nx+4,ncrms);
+  real2d iadz  = ws.get<2>("iadz" ,nzm,ncrms);
+  real2d irho  = ws.get<2>("irho" ,nzm,ncrms);
+  real2d irhow = ws.get<2>("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -23,14 +23,15 @@ void advect_scalar3D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  workspace_frame ws;
+  real4d mx    = ws.get<4>("mx"   ,nzm,ny+2,nx+2,ncrms);
+  real4d mn    = ws.get<4>("mn"   ,nzm,ny+2,nx+2,ncrms);
+  real4d uuu   = ws.get<4>("uuu"  ,nzm,ny+4,nx+5,ncrms);
+  real4d vvv   = ws.get<4>("vvv"  ,nzm,ny+5,nx+4,ncrms);
+  real4d www   = ws.get<4>("www"  ,nz ,ny+4,nx+4,ncrms);
+  real2d iadz  = ws.get<2>("iadz" ,nzm,ncrms);
+  real2d irho  = ws.get<2>("irho" ,nzm,ncrms);
+  real2d irhow = ws.get<2>("irhow",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny+4; j++) {
@@ -320,14 +321,15 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  workspace_frame ws;
+  real4d mx    = ws.get<4>("mx"   ,nzm,ny+2,nx+2,ncrms);
+  real4d mn    = ws.get<4>("mn"   ,nzm,ny+2,nx+2,ncrms);
+  real4d uuu   = ws.get<4>("uuu"  ,nzm,ny+4,nx+5,ncrms);
+  real4d vvv   = ws.get<4>("vvv"  ,nzm,ny+5,nx+4,ncrms);
+  real4d www   = ws.get<4>("www"  ,nz ,ny+4,nx+4,ncrms);
+  real2d iadz  = ws.get<2>("iadz" ,nzm,ncrms);
+  real2d irho  = ws.get<2>("irho" ,nzm,ncrms);
+  real2d irhow = ws.get<2>("irhow",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny+4; j++) {
@@ -617,14 +619,15 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  workspace_frame ws;
+  real4d mx    = ws.get<4>("mx"   ,nzm,ny+2,nx+2,ncrms);
+  real4d mn    = ws.get<4>("mn"   ,nzm,ny+2,nx+2,ncrms);
+  real4d uuu   = ws.get<4>("uuu"  ,nzm,ny+4,nx+5,ncrms);
+  real4d vvv   = ws.get<4>("vvv"  ,nzm,ny+5,nx+4,ncrms);
+  real4d www   = ws.get<4>("www"  ,nz ,ny+4,nx+4,ncrms);
+  real2d iadz  = ws.get<2>("iadz" ,nzm,ncrms);
+  real2d irho  = ws.get<2>("irho" ,nzm,ncrms);
+  real2d irhow = ws.get<2>("irhow",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny+4; j++) {
@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "crm_workspace.h"
 
 void advect_scalar3D(real4d &f, real2d &flux);
 
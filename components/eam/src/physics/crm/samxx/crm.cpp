@@ -3,6 +3,7 @@
 #include "post_timeloop.h"
 #include "timeloop.h"
 #include "vars.h"
+#include "crm_workspace.h"
 
 
 extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_input_bflxls_p, 
@@ -101,6 +102,8 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
 
   allocate();
 
+  workspace_allocate();
+
   init_values();
 
   pre_timeloop();
@@ -137,6 +140,8 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
                            crm_output_prec_crm_p, 
 	                   crm_clear_rh_p);
 
+  workspace_finalize();
+
   finalize();
   
   yakl::fence();
@@ -0,0 +1,53 @@
+
+#include "crm_workspace.h"
+
+real1d workspace          ;
+int    workspace_top       = 0;
+int    workspace_allocs    = 0;
+int    workspace_allocs_max = 0;
+
+
+static int workspace_chunk(int n) {
+  return ((n + workspace_align - 1) / workspace_align) * workspace_align;
+}
+
+
+void workspace_allocate() {
+  // advect_scalar3D: mx, mn, uuu, vvv, www, iadz, irho, irhow
+  // (advect_scalar2D takes the same temporaries with ny=1, so it always fits here too)
+  int adv = 2*workspace_chunk(nzm*(ny+2)*(nx+2)*ncrms) +
+              workspace_chunk(nzm*(ny+4)*(nx+5)*ncrms) +
+              workspace_chunk(nzm*(ny+5)*(nx+4)*ncrms) +
+              workspace_chunk(nz *(ny+4)*(nx+4)*ncrms) +
+            3*workspace_chunk(nzm*ncrms);
+
+  // pressure: f
+  int nzslab = max(1,nzm/nsubdomains);
+  int press  = workspace_chunk(nzslab*(ny+2*YES3D)*(nx+2)*ncrms);
+
+  workspace            = real1d("workspace", max(adv,press));
+  workspace_top        = 0;
+  workspace_allocs     = 0;
+  workspace_allocs_max = 0;
+}
+
+
+void workspace_finalize() {
+  workspace     = real1d();
+  workspace_top = 0;
+}
+
+
+void workspace_begin_step() {
+  workspace_allocs = 0;
+}
+
+
+void workspace_end_step() {
+  workspace_allocs_max = max(workspace_allocs_max, workspace_allocs);
+}
+
+
+extern "C" int crm_workspace_allocs_max() {
+  return workspace_allocs_max;
+}
@@ -0,0 +1,74 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include "vars.h"
+
+//////////////////////////////////////////////////////////////////////////////////
+// Persistent scratch arena for CRM temporaries
+//
+// The arena is sized once per crm() call from ncrms/nx/ny/nzm and routines inside
+// the time loop take their temporaries as unmanaged views into it instead of
+// allocating new YAKL arrays on every call. Space is handed out stack-wise through
+// a workspace_frame, which releases everything it handed out when it goes out of
+// scope. Kernels are launched in order on a single stream, so reusing the space
+// for the next routine's temporaries is safe without a fence.
+//
+// Requests that do not fit fall back to a regular allocation and are counted, so
+// a routine that grows beyond the arena shows up in workspace_allocs_max, which the
+// host model queries through crm_workspace_allocs_max() after each crm() call.
+//////////////////////////////////////////////////////////////////////////////////
+
+extern real1d workspace          ;
+extern int    workspace_top      ; // Next free element in workspace
+extern int    workspace_allocs   ; // Fallback allocations during the current CRM step
+extern int    workspace_allocs_max; // Largest per-step fallback count during this crm() call
+
+int  constexpr workspace_align = 32; // Elements; keeps every view 256-byte aligned for doubles
+
+
+void workspace_allocate();
+
+
+void workspace_finalize();
+
+
+// Reset the per-step allocation counter at the start of a CRM step
+void workspace_begin_step();
+
+
+// Fold the per-step allocation counter into workspace_allocs_max
+void workspace_end_step();
+
+
+// Largest per-step fallback count during the last crm() call
+extern "C" int crm_workspace_allocs_max();
+
+
+class workspace_frame {
+  int top0;
+
+public:
+
+  workspace_frame() : top0(workspace_top) {}
+
+  ~workspace_frame() { workspace_top = top0; }
+
+  workspace_frame(workspace_frame const &) = delete;
+  workspace_frame &operator=(workspace_frame const &) = delete;
+
+  template <int N, class... DIMS>
+  yakl::Array<real,N,yakl::memDevice,yakl::styleC> get(char const *label, DIMS... dims) {
+    static_assert(N == sizeof...(DIMS), "workspace_frame::get: rank does not match number of dimensions");
+    int n = 1;
+    for (int d : {static_cast<int>(dims)...}) { n *= d; }
+    int nalloc = ((n + workspace_align - 1) / workspace_align) * workspace_align;
+    if (workspace.initialized() && workspace_top + nalloc <= workspace.get_totElems()) {
+      real *ptr = workspace.data() + workspace_top;
+      workspace_top += nalloc;
+      return yakl::Array<real,N,yakl::memDevice,yakl::styleC>(label, ptr, dims...);
+    }
+    workspace_allocs++;
+    return yakl::Array<real,N,yakl::memDevice,yakl::styleC>(label, dims...);
+  }
+};
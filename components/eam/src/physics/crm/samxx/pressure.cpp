@@ -20,10 +20,11 @@ void pressure() {
   int constexpr n3j=3*ny_gl/2+1;
   int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
+  // The vertical solve below works in place on f, which needs the whole column in one slab
+  static_assert(nsubdomains == 1, "pressure: in-place vertical solve assumes a single pressure slab");
+
+  workspace_frame ws;
+  real4d f = ws.get<4>("f" , nzslab, ny2, nx2, ncrms);
 
   int iwall = 0;
   int nypp, jwall;
@@ -35,8 +36,6 @@ void pressure() {
     nypp = ny+2;
   }
 
-  real2d eign("eign",nypp,nx+1);
-
   press_rhs();
 
   // for (int k=0; k<nzslab; k++) {
@@ -47,7 +46,12 @@ void pressure() {
     f(k,j,i,icrm) = p(k,j+offy_p,i+offx_p,icrm);
   });
 
-  #ifndef USE_ORIG_FFT
+  #if defined(USE_BATCHED_FFT)
+
+    pressure_batched_fftx.forward_real(f, 2, nx, ny);
+    if (RUN3D) { pressure_batched_ffty.forward_real(f, 1, ny); }
+
+  #elif !defined(USE_ORIG_FFT)
 
     pressure_fftx.forward_real(f, 2, nx);
     if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
@@ -93,24 +97,17 @@ void pressure() {
 
   #endif
 
-  // for(int k=0; k<nzslab; k++) {
-  //  for(int j=0; j<nypp; j++) {
-  //    for(int i=0; i<nx+1; i++) {
-  //      for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    ff(k,j,i,icrm) = f(k,j,i,icrm);
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    a(k,icrm)=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
-    c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
-  });
+  // Solve the tridiagonal system in z for every horizontal wavenumber of every CRM in one
+  // kernel, in place on the spectral coefficients. The eigenvalues of the horizontal
+  // Laplacian and the vertical coefficients are formed on the fly rather than staged
+  // through separate arrays.
+  // for (int j=0; j<nypp; j++) {
+  //   for (int i=0; i<nx+1; i++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    SArray<real,1,nzm-1> alfa;
+    SArray<real,1,nzm-1> beta;
 
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
     int jt = 0;
     int it = 0;
 
@@ -125,54 +122,45 @@ void pressure() {
     int id=((i+1)+it-0.1)/2.0;
     real factx = 2.0;
     real xi=id;
-    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
-  });
+    real eign=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
 
-  // for (int j=0; j<nypp; j++) {
-  //  for (int i=0; i<nx+1; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    SArray<real,1,nzm-1> alfa;
-    SArray<real,1,nzm-1> beta;
+    real dz2 = dz(icrm)*dz(icrm);
+    real a, c;
 
-    int jt = 0;
-    int it = 0;
-    int jd=((j+1)+jt-0.1)/2.0;
-    int id=((i+1)+it-0.1)/2.0;
+    a=rhow(0,icrm)/(adz(0,icrm)*adzw(0,icrm)*dz2);
+    c=rhow(1,icrm)/(adz(0,icrm)*adzw(1,icrm)*dz2);
     real b;
     if(id+jd == 0) {
-      b=1.0/(eign(j,i)*rho(0,icrm)-a(0,icrm)-c(0,icrm));
-      alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
+      b=1.0/(eign*rho(0,icrm)-a-c);
     }
     else {
-      b=1.0/(eign(j,i)*rho(0,icrm)-c(0,icrm));
-      alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
+      b=1.0/(eign*rho(0,icrm)-c);
     }
+    alfa(0)=-c*b;
+    beta(0)=f(0,j,i,icrm)*b;
 
     real e;
     for(int k=1; k<nzm-1; k++) {
-      e=1.0/(eign(j,i)*rho(k,icrm)-a(k,icrm)-c(k,icrm)+a(k,icrm)*alfa(k-1));
-      alfa(k)=-c(k,icrm)*e;
-      beta(k)=(ff(k,j,i,icrm)-a(k,icrm)*beta(k-1))*e;
+      a=rhow(k  ,icrm)/(adz(k,icrm)*adzw(k  ,icrm)*dz2);
+      c=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz2);
+      e=1.0/(eign*rho(k,icrm)-a-c+a*alfa(k-1));
+      alfa(k)=-c*e;
+      beta(k)=(f(k,j,i,icrm)-a*beta(k-1))*e;
     }
-    ff(nzm-1,j,i,icrm)=(ff(nzm-1,j,i,icrm)-a(nzm-1,icrm)*beta(nzm-2))/
-                       (eign(j,i)*rho(nzm-1,icrm)-a(nzm-1,icrm)+a(nzm-1,icrm)*alfa(nzm-2));
+    a=rhow(nzm-1,icrm)/(adz(nzm-1,icrm)*adzw(nzm-1,icrm)*dz2);
+    f(nzm-1,j,i,icrm)=(f(nzm-1,j,i,icrm)-a*beta(nzm-2))/
+                      (eign*rho(nzm-1,icrm)-a+a*alfa(nzm-2));
     for(int k=nzm-2; k>=0; k--) {
-      ff(k,j,i,icrm)=alfa(k)*ff(k+1,j,i,icrm)+beta(k);
+      f(k,j,i,icrm)=alfa(k)*f(k+1,j,i,icrm)+beta(k);
     }
   });
 
-  // for (int k=0; k<nzslab; k++) {
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    f(k,j,i,icrm) = ff(k,j,i,icrm);
-  });
+  #if defined(USE_BATCHED_FFT)
+
+    if (RUN3D) { pressure_batched_ffty.inverse_real(f, 1, ny); }
+    pressure_batched_fftx.inverse_real(f, 2, nx, ny);
 
-  #ifndef USE_ORIG_FFT
+  #elif !defined(USE_ORIG_FFT)
 
     if (RUN3D) { pressure_ffty.inverse_real(f); }
     pressure_fftx.inverse_real(f);
@@ -4,6 +4,7 @@
 #include "samxx_const.h"
 #include "YAKL_fft.h"
 #include "vars.h"
+#include "crm_workspace.h"
 #include "press_rhs.h"
 #include "press_grad.h"
 
@@ -0,0 +1,228 @@
+
+#include "pressure_fft.h"
+#include <algorithm>
+#include <vector>
+
+int constexpr fft_row_align = 64 / sizeof(real); // Pad rows to a 64-byte cache line
+
+
+// Ordered complex DFT, Z(k) = sum_j z(j) exp(-2 pi i j k / nh), of the nh complex values
+// stored interleaved in work(b,0:2*nh-1), using work(b,2*nh:4*nh-1) as the second buffer.
+// Each Stockham pass combines ns-point transforms into (ns*p)-point ones with a radix-p
+// butterfly, reading and writing in natural order, so no bit reversal is needed. The
+// twiddle and butterfly factors are merged into one lookup in the length 2*nh tables.
+// Returns the offset (0 or 2*nh) of the buffer holding the result.
+YAKL_INLINE int fft_stockham(real2d const &work, int b, int nh, int nfactor, int1d const &factors,
+                             real1d const &trig_cos, real1d const &trig_sin) {
+  int in  = 0;
+  int out = 2*nh;
+  int ns  = 1;
+  for (int f=0; f<nfactor; f++) {
+    int p     = factors(f);
+    int nbfly = nh / p;
+    int tstep = nh / (ns*p);
+    for (int j=0; j<nbfly; j++) {
+      int jm  = j % ns;
+      int dst = (j/ns)*ns*p + jm;
+      for (int r=0; r<p; r++) {
+        real re = 0;
+        real im = 0;
+        for (int s=0; s<p; s++) {
+          // exp(-2 pi i q / nh) = cos - i sin of entry 2q of the length 2*nh tables
+          int  q  = (s*(jm + r*ns)*tstep) % nh;
+          real c  = trig_cos(2*q);
+          real sn = trig_sin(2*q);
+          real xr = work(b,in+2*(j+s*nbfly)  );
+          real xi = work(b,in+2*(j+s*nbfly)+1);
+          re += xr*c + xi*sn;
+          im += xi*c - xr*sn;
+        }
+        work(b,out+2*(dst+r*ns)  ) = re;
+        work(b,out+2*(dst+r*ns)+1) = im;
+      }
+    }
+    int tmp = in; in = out; out = tmp;
+    ns *= p;
+  }
+  return in;
+}
+
+
+void BatchedRealFFT::init(int n_in, int nbatch_in) {
+  if (n_in % 2 != 0) {
+    std::cout << "BatchedRealFFT: transform length must be even, got " << n_in << std::endl;
+    exit(-1);
+  }
+  n      = n_in;
+  nbatch = nbatch_in;
+  stride = ((2*n + fft_row_align - 1) / fft_row_align) * fft_row_align;
+
+  // Radix of each pass: fours first, then the remaining prime factors of n/2
+  std::vector<int> radix;
+  int rem = n/2;
+  while (rem % 4 == 0) { radix.push_back(4); rem /= 4; }
+  for (int p=2; rem > 1; p++) {
+    while (rem % p == 0) { radix.push_back(p); rem /= p; }
+  }
+  nfactor = radix.size();
+  intHost1d factorsHost("fft_factors",std::max(nfactor,1));
+  factorsHost(0) = 1;
+  for (int f=0; f<nfactor; f++) { factorsHost(f) = radix[f]; }
+
+  realHost1d cosHost("trig_cos",n);
+  realHost1d sinHost("trig_sin",n);
+  double pii = 3.14159265358979323846;
+  for (int j=0; j<n; j++) {
+    double theta = 2.0*pii*j/n;
+    cosHost(j) = cos(theta);
+    sinHost(j) = sin(theta);
+  }
+  factors  = factorsHost.createDeviceCopy();
+  trig_cos = cosHost.createDeviceCopy();
+  trig_sin = sinHost.createDeviceCopy();
+  work     = real2d("fft_work",nbatch,stride);
+}
+
+
+void BatchedRealFFT::cleanup() {
+  factors  = int1d();
+  trig_cos = real1d();
+  trig_sin = real1d();
+  work     = real2d();
+  n        = 0;
+  stride   = 0;
+  nbatch   = 0;
+  nfactor  = 0;
+}
+
+
+// Sizes the batch for a transform along dim and (re)builds the tables and work buffer
+// when the transform length or batch size changed. nrow is the extent of the other middle
+// dimension that takes part, nbat the total number of transforms.
+void BatchedRealFFT::prepare(real4d const &arr, int dim, int n_in, int ncount, int &nrow, int &nbat) {
+  if (dim != 1 && dim != 2) {
+    std::cout << "BatchedRealFFT: can only transform along dimension 1 or 2, got " << dim << std::endl;
+    exit(-1);
+  }
+  int other = dim == 2 ? 1 : 2;
+  nrow = ncount < 0 ? arr.dimension[other] : ncount;
+  nbat = arr.dimension[0] * nrow * arr.dimension[3];
+  if (n_in != n || nbat > nbatch) { init(n_in, nbat); }
+}
+
+
+void BatchedRealFFT::forward_real(real4d &arr, int dim, int n_in, int ncount) {
+  int nrow, nbat;
+  prepare(arr, dim, n_in, ncount, nrow, nbat);
+
+  YAKL_SCOPE( factors  , this->factors );
+  YAKL_SCOPE( trig_cos , this->trig_cos );
+  YAKL_SCOPE( trig_sin , this->trig_sin );
+  YAKL_SCOPE( work     , this->work );
+  int n       = this->n;
+  int nh      = n/2;
+  int nfactor = this->nfactor;
+  int ncol    = arr.dimension[3];
+  real rn     = 1.0/n;
+
+  // One transform per thread. The batch index runs (k,row,icrm) with icrm fastest,
+  // matching the array layout.
+  // for (int b=0; b<nbat; b++) {
+  parallel_for( nbat , YAKL_LAMBDA (int b) {
+    int icrm = b % ncol;
+    int row  = (b / ncol) % nrow;
+    int k    = b / (ncol*nrow);
+
+    // The grid values, in order, are the complex values z(j) = x(2j) + i x(2j+1)
+    for (int j=0; j<n; j++) {
+      work(b,j) = dim == 2 ? arr(k,row,j,icrm) : arr(k,j,row,icrm);
+    }
+    int z = fft_stockham(work, b, nh, nfactor, factors, trig_cos, trig_sin);
+
+    // Split Z into the transforms of the even and odd values, E and O, which
+    // combine into X(m) = E(m) + exp(-2 pi i m / n) O(m), with X = n (a + i b)
+    for (int m=0; m<=nh; m++) {
+      int  k1  = m % nh;
+      int  k2  = (nh - m) % nh;
+      real z1r = work(b,z+2*k1);
+      real z1i = work(b,z+2*k1+1);
+      real z2r = work(b,z+2*k2);
+      real z2i = work(b,z+2*k2+1);
+      real er  = 0.5*(z1r + z2r);
+      real ei  = 0.5*(z1i - z2i);
+      real orr = 0.5*(z1i + z2i);
+      real oi  = 0.5*(z2r - z1r);
+      real c   = trig_cos(m);
+      real sn  = trig_sin(m);
+      real xr  = er + c*orr + sn*oi;
+      real xi  = ei + c*oi  - sn*orr;
+      if (dim == 2) {
+        arr(k,row,2*m  ,icrm) = xr*rn;
+        arr(k,row,2*m+1,icrm) = xi*rn;
+      } else {
+        arr(k,2*m  ,row,icrm) = xr*rn;
+        arr(k,2*m+1,row,icrm) = xi*rn;
+      }
+    }
+  });
+}
+
+
+void BatchedRealFFT::inverse_real(real4d &arr, int dim, int n_in, int ncount) {
+  int nrow, nbat;
+  prepare(arr, dim, n_in, ncount, nrow, nbat);
+
+  YAKL_SCOPE( factors  , this->factors );
+  YAKL_SCOPE( trig_cos , this->trig_cos );
+  YAKL_SCOPE( trig_sin , this->trig_sin );
+  YAKL_SCOPE( work     , this->work );
+  int n       = this->n;
+  int nh      = n/2;
+  int nfactor = this->nfactor;
+  int ncol    = arr.dimension[3];
+
+  // for (int b=0; b<nbat; b++) {
+  parallel_for( nbat , YAKL_LAMBDA (int b) {
+    int icrm = b % ncol;
+    int row  = (b / ncol) % nrow;
+    int k    = b / (ncol*nrow);
+
+    // Spectral coefficient A(m) = a(m) + i b(m). As in fft991_crm, b(0) and b(n/2) are ignored.
+    auto coef = [&] (int m, real &ar, real &ai) {
+      ar = dim == 2 ? arr(k,row,2*m  ,icrm) : arr(k,2*m  ,row,icrm);
+      ai = dim == 2 ? arr(k,row,2*m+1,icrm) : arr(k,2*m+1,row,icrm);
+      if (m == 0 || m == nh) { ai = 0; }
+    };
+
+    // Merge the transforms of the even and odd values into Z(k) = E(k) + i O(k), with
+    // E(k) = (A(k) + conj(A(n/2-k)))/2 and O(k) = exp(2 pi i k / n) (A(k) - conj(A(n/2-k)))/2.
+    // Then x(2j) + i x(2j+1) = 2 sum_k Z(k) exp(2 pi i j k / nh), which is computed as the
+    // conjugate of the forward FFT of conj(Z).
+    for (int m=0; m<nh; m++) {
+      real a1r, a1i, a2r, a2i;
+      coef(m   , a1r, a1i);
+      coef(nh-m, a2r, a2i);
+      real er  = 0.5*(a1r + a2r);
+      real ei  = 0.5*(a1i - a2i);
+      real dr  = 0.5*(a1r - a2r);
+      real di  = 0.5*(a1i + a2i);
+      real c   = trig_cos(m);
+      real sn  = trig_sin(m);
+      real orr = c*dr - sn*di;
+      real oi  = c*di + sn*dr;
+      work(b,2*m  ) =  2*(er - oi );
+      work(b,2*m+1) = -2*(ei + orr);
+    }
+    int z = fft_stockham(work, b, nh, nfactor, factors, trig_cos, trig_sin);
+
+    for (int j=0; j<nh; j++) {
+      if (dim == 2) {
+        arr(k,row,2*j  ,icrm) =  work(b,z+2*j);
+        arr(k,row,2*j+1,icrm) = -work(b,z+2*j+1);
+      } else {
+        arr(k,2*j  ,row,icrm) =  work(b,z+2*j);
+        arr(k,2*j+1,row,icrm) = -work(b,z+2*j+1);
+      }
+    }
+  });
+}
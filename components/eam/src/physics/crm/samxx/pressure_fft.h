@@ -0,0 +1,51 @@
+#pragma once
+
+#include "samxx_const.h"
+
+//////////////////////////////////////////////////////////////////////////////////
+// Batched real FFTs for the pressure Poisson solve
+//
+// All 1-D transforms along one dimension of a (nzslab,ny2,nx2,ncrms) array are
+// done as a single batch, one transform per thread. Each real transform of length
+// n is computed as a complex FFT of length n/2 on the packed pairs
+// x(2j) + i x(2j+1), followed by an O(n) split into the n/2+1 spectral
+// coefficients. The complex FFT is a mixed-radix Stockham (self-sorting)
+// transform with one O(n) pass per prime factor of n/2, so any even n is
+// supported at O(n log n) cost. Each transform works in a row of a contiguous
+// work buffer, whose row stride is padded to a cache line.
+//
+// Spectral layout and normalization match fft991_crm and yakl::RealFFT1D, so the
+// three are interchangeable in pressure():
+//   a(m) =  1/n sum_j x(j) cos(2 pi j m / n)
+//   b(m) = -1/n sum_j x(j) sin(2 pi j m / n)     m = 0, ..., n/2
+// stored interleaved as a(0),b(0),a(1),b(1),...,a(n/2),b(n/2) in n+2 entries.
+//////////////////////////////////////////////////////////////////////////////////
+
+class BatchedRealFFT {
+public:
+  int    n;        // Transform length (must be even)
+  int    stride;   // Row length of the work buffer, padded to a cache line
+  int    nbatch;   // Number of rows the work buffer holds
+  int    nfactor;  // Number of Stockham passes of the length n/2 complex FFT
+  int1d  factors;  // Radix of each pass, whose product is n/2
+  real1d trig_cos; // cos(2 pi j / n), j = 0, ..., n-1
+  real1d trig_sin; // sin(2 pi j / n), j = 0, ..., n-1
+  real2d work;     // Two complex buffers of n/2 values per row, as (nbatch, stride)
+
+  BatchedRealFFT() : n(0), stride(0), nbatch(0), nfactor(0) {}
+
+  void init(int n, int nbatch);
+
+  void cleanup();
+
+  // Forward transform of the first n entries along dim (1 or 2) of arr into n+2 spectral
+  // entries. Only the first ncount entries of the other middle dimension are transformed
+  // (all of them when ncount < 0).
+  void forward_real(real4d &arr, int dim, int n, int ncount = -1);
+
+  // Inverse of forward_real: n+2 spectral entries along dim back to n grid values
+  void inverse_real(real4d &arr, int dim, int n, int ncount = -1);
+
+private:
+  void prepare(real4d const &arr, int dim, int n, int ncount, int &nrow, int &nbat);
+};
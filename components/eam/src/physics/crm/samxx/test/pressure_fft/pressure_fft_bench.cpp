@@ -0,0 +1,168 @@
+
+#include "pressure_fft.h"
+#include "YAKL_fft.h"
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+// Times the x/y transforms of the pressure solve with BatchedRealFFT and with
+// yakl::RealFFT1D over typical MMF CRM sizes. Also checks that both engines give
+// the same spectral coefficients and that the batched round trip recovers the input,
+// and checks BatchedRealFFT against a direct DFT for lengths with factors 2, 3, 5, 7.
+//
+// Usage: pressure_fft_bench [nrepeat]
+
+struct Case { int nx, ny, nzm, ncrms; };
+
+// Max error of the batched forward transform against a direct DFT, and of its round trip
+real check_against_dft(int n) {
+  int nzm = 3, ncrms = 2;
+  realHost4d initHost("init",nzm,1,n+2,ncrms);
+  for (int i=0; i<initHost.get_totElems(); i++) {
+    initHost.data()[i] = static_cast<real>(rand()) / static_cast<real>(RAND_MAX) - 0.5;
+  }
+  real4d f = initHost.createDeviceCopy();
+  BatchedRealFFT bfft;
+  bfft.forward_real(f, 2, n);
+  realHost4d fHost = f.createHostCopy();
+  real maxdiff = 0;
+  double pii = 3.14159265358979323846;
+  for (int k=0; k<nzm; k++) {
+    for (int icrm=0; icrm<ncrms; icrm++) {
+      for (int m=0; m<=n/2; m++) {
+        real sa = 0;
+        real sb = 0;
+        for (int j=0; j<n; j++) {
+          sa += initHost(k,0,j,icrm)*cos(2*pii*j*m/n);
+          sb += initHost(k,0,j,icrm)*sin(2*pii*j*m/n);
+        }
+        maxdiff = std::max(maxdiff, std::abs(fHost(k,0,2*m  ,icrm) - sa/n));
+        maxdiff = std::max(maxdiff, std::abs(fHost(k,0,2*m+1,icrm) + sb/n));
+      }
+    }
+  }
+  bfft.inverse_real(f, 2, n);
+  fHost = f.createHostCopy();
+  for (int k=0; k<nzm; k++) {
+    for (int icrm=0; icrm<ncrms; icrm++) {
+      for (int j=0; j<n; j++) {
+        maxdiff = std::max(maxdiff, std::abs(fHost(k,0,j,icrm) - initHost(k,0,j,icrm)));
+      }
+    }
+  }
+  bfft.cleanup();
+  return maxdiff;
+}
+
+template <class F> double time_per_call(int nrepeat, F const &f) {
+  f();
+  yakl::fence();
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r=0; r<nrepeat; r++) { f(); }
+  yakl::fence();
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t1-t0).count() / nrepeat;
+}
+
+int main(int argc, char **argv) {
+  int nrepeat = argc > 1 ? atoi(argv[1]) : 100;
+  int nerr = 0;
+  yakl::init();
+  {
+    std::vector<Case> cases = { { 32, 1,58,256}, { 64, 1,58,128}, {128, 1,58, 64},
+                                { 16,16,58, 32}, { 32,32,58,  8} };
+    std::cout << std::setw(5) << "nx" << std::setw(5) << "ny" << std::setw(5) << "nzm" << std::setw(7) << "ncrms"
+              << std::setw(14) << "yakl [s]" << std::setw(14) << "batched [s]" << std::setw(10) << "speedup"
+              << std::setw(14) << "max diff" << std::endl;
+
+    for (auto const &cs : cases) {
+      int  nx    = cs.nx;
+      int  ny    = cs.ny;
+      int  nzm   = cs.nzm;
+      int  ncrms = cs.ncrms;
+      bool run3d = ny > 1;
+      int  ny2   = run3d ? ny+2 : 1;
+
+      realHost4d initHost("init",nzm,ny2,nx+2,ncrms);
+      for (int i=0; i<initHost.get_totElems(); i++) {
+        initHost.data()[i] = static_cast<real>(rand()) / static_cast<real>(RAND_MAX) - 0.5;
+      }
+      real4d init = initHost.createDeviceCopy();
+      real4d f1("f1",nzm,ny2,nx+2,ncrms);
+      real4d f2("f2",nzm,ny2,nx+2,ncrms);
+
+      yakl::RealFFT1D<real> fftx, ffty;
+      BatchedRealFFT bfftx, bffty;
+
+      // Forward transforms with both engines must agree
+      init.deep_copy_to(f1);
+      init.deep_copy_to(f2);
+      fftx.forward_real(f1, 2, nx);
+      if (run3d) { ffty.forward_real(f1, 1, ny); }
+      bfftx.forward_real(f2, 2, nx, ny);
+      if (run3d) { bffty.forward_real(f2, 1, ny); }
+      realHost4d f1Host = f1.createHostCopy();
+      realHost4d f2Host = f2.createHostCopy();
+      real maxdiff = 0;
+      for (int k=0; k<nzm; k++) {
+        for (int j=0; j<ny2; j++) {
+          for (int i=0; i<nx+1; i++) {
+            for (int icrm=0; icrm<ncrms; icrm++) {
+              maxdiff = std::max(maxdiff, std::abs(f1Host(k,j,i,icrm) - f2Host(k,j,i,icrm)));
+            }
+          }
+        }
+      }
+
+      // The batched round trip must recover the input
+      if (run3d) { bffty.inverse_real(f2, 1, ny); }
+      bfftx.inverse_real(f2, 2, nx, ny);
+      f2Host = f2.createHostCopy();
+      for (int k=0; k<nzm; k++) {
+        for (int j=0; j<ny; j++) {
+          for (int i=0; i<nx; i++) {
+            for (int icrm=0; icrm<ncrms; icrm++) {
+              maxdiff = std::max(maxdiff, std::abs(initHost(k,j,i,icrm) - f2Host(k,j,i,icrm)));
+            }
+          }
+        }
+      }
+      if (maxdiff > 1.e-10) { nerr++; }
+
+      double tyakl = time_per_call(nrepeat, [&] () {
+        fftx.forward_real(f1, 2, nx);
+        if (run3d) { ffty.forward_real(f1, 1, ny); }
+        if (run3d) { ffty.inverse_real(f1); }
+        fftx.inverse_real(f1);
+      });
+      double tbatched = time_per_call(nrepeat, [&] () {
+        bfftx.forward_real(f2, 2, nx, ny);
+        if (run3d) { bffty.forward_real(f2, 1, ny); }
+        if (run3d) { bffty.inverse_real(f2, 1, ny); }
+        bfftx.inverse_real(f2, 2, nx, ny);
+      });
+
+      std::cout << std::setw(5) << nx << std::setw(5) << ny << std::setw(5) << nzm << std::setw(7) << ncrms
+                << std::scientific << std::setprecision(3)
+                << std::setw(14) << tyakl << std::setw(14) << tbatched
+                << std::fixed << std::setprecision(2) << std::setw(10) << tyakl/tbatched
+                << std::scientific << std::setprecision(2) << std::setw(14) << maxdiff << std::endl;
+
+      fftx.cleanup();
+      ffty.cleanup();
+      bfftx.cleanup();
+      bffty.cleanup();
+    }
+  }
+  {
+    for (int n : {2, 6, 10, 14, 24, 48, 60, 96}) {
+      real maxdiff = check_against_dft(n);
+      std::cout << "n = " << std::setw(3) << n << ": max diff against direct DFT "
+                << std::scientific << std::setprecision(2) << maxdiff << std::endl;
+      if (maxdiff > 1.e-12) { nerr++; }
+    }
+  }
+  yakl::finalize();
+  if (nerr > 0) { std::cout << "FAIL: " << nerr << " case(s) exceeded tolerance" << std::endl; }
+  return nerr > 0 ? -1 : 0;
+}
@@ -17,6 +17,8 @@ void timeloop() {
   do {
     nstep = nstep + 1;
 
+    workspace_begin_step();
+
     //------------------------------------------------------------------
     //  Check if the dynamical time step should be decreased
     //  to handle the cases when the flow being locally linearly unstable
@@ -190,6 +192,8 @@ void timeloop() {
 
     post_icycle();
 
+    workspace_end_step();
+
   } while (nstep < nstop);
 
 }
@@ -671,6 +671,8 @@ void finalize() {
 
   pressure_fftx.cleanup();
   pressure_ffty.cleanup();
+  pressure_batched_fftx.cleanup();
+  pressure_batched_ffty.cleanup();
   vt_fftx.cleanup();
   vt_ffty.cleanup();
   esmt_fftx.cleanup();
@@ -1975,6 +1977,8 @@ int igstep;
 
 yakl::RealFFT1D<real> pressure_fftx;
 yakl::RealFFT1D<real> pressure_ffty;
+BatchedRealFFT        pressure_batched_fftx;
+BatchedRealFFT        pressure_batched_ffty;
 yakl::RealFFT1D<real> vt_fftx;
 yakl::RealFFT1D<real> vt_ffty;
 yakl::RealFFT1D<real> esmt_fftx;
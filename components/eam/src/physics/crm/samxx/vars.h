@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "YAKL_fft.h"
+#include "pressure_fft.h"
 
 
 void allocate();
@@ -554,6 +555,8 @@ extern int igstep;
 
 extern yakl::RealFFT1D<real> pressure_fftx;
 extern yakl::RealFFT1D<real> pressure_ffty;
+extern BatchedRealFFT        pressure_batched_fftx;
+extern BatchedRealFFT        pressure_batched_ffty;
 extern yakl::RealFFT1D<real> vt_fftx;
 extern yakl::RealFFT1D<real> vt_ffty;
 extern yakl::RealFFT1D<real> esmt_fftx;
@@ -948,6 +948,15 @@ void AtmosphereDriver::restart_model ()
 
   m_atm_logger->info("    [EAMxx] Restart filename: " + filename);
 
+  // Keep the file open until we are done. Otherwise, each grid reader and each
+  // attribute query below would (collectively) open and close the file, and
+  // re-process the decomposition of all its vars.
+  scorpio::register_file(filename,scorpio::Read);
+
+  // Optionally, read on a subset of the ranks, and send the data to the other ranks
+  const auto& restart_pl = m_atm_params.sublist("scorpio").sublist("model_restart");
+  const int num_reader_ranks = restart_pl.get<int>("num_reader_ranks",0);
+
   for (auto& gn : m_grids_manager->get_grid_names()) {
     if (fvphyshack and gn == "physics_gll") continue;
     if (not m_field_mgr->has_group("RESTART", gn)) {
@@ -966,7 +975,18 @@ void AtmosphereDriver::restart_model ()
       }
       fields.push_back(m_field_mgr->get_field(fn,gn));
     }
-    read_fields_from_file (fields,m_grids_manager->get_grid(gn),filename);
+
+    // With incremental restart writes, fields that did not change since a previous
+    // restart file are not in this file, which instead stores the name of the file
+    // holding their data. Group fields by the file they must be read from.
+    const auto fields_per_file = group_restart_fields_by_data_file(filename,fields,m_atm_comm);
+    for (const auto& [fname,file_fields] : fields_per_file) {
+      if (fname!=filename) {
+        m_atm_logger->info("    [EAMxx] Reading " + std::to_string(file_fields.size()) +
+                           " unchanged fields on grid " + gn + " from " + fname);
+      }
+      read_fields_on_rank_subset (fname,file_fields,m_grids_manager->get_grid(gn),num_reader_ranks);
+    }
     for (auto& f : fields) {
       f.get_header().get_tracking().update_time_stamp(m_current_ts);
     }
@@ -993,6 +1013,7 @@ void AtmosphereDriver::restart_model ()
           " - extra data typeid: " + std::string(any.type().name()) + "\n");
     }
   }
+  scorpio::release_file(filename);
 
   m_atm_logger->info("  [EAMxx] restart_model ... done!");
 }
@@ -1556,9 +1577,16 @@ void AtmosphereDriver::initialize_atm_procs ()
 
   // Initialize memory buffer for all atm processes
   m_memory_buffer = std::make_shared<ATMBufferManager>();
-  m_memory_buffer->request_bytes(m_atm_process_group->requested_buffer_size_in_bytes());
+  m_atm_process_group->request_buffers(*m_memory_buffer);
   m_memory_buffer->allocate();
   m_atm_process_group->init_buffers(*m_memory_buffer);
+  m_atm_logger->info("[EAMxx::init] " + m_memory_buffer->usage_report());
+
+  // If requested, track how much of its buffer each process actually uses
+  if (m_atm_params.sublist("driver_options").get<bool>("poison_scratch_buffers",false)) {
+    m_memory_buffer->set_poisoning(true);
+    m_atm_process_group->set_buffer_manager(m_memory_buffer);
+  }
 
   // Setup SurfaceCoupling import and export (if they exist)
   if (m_surface_coupling_import_data_manager || m_surface_coupling_export_data_manager) {
@@ -1758,7 +1786,10 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
   // Destroy iop
   m_iop_data_manager = nullptr;
 
-  // Destroy the buffer manager
+  // Report the buffer usage, then destroy the buffer manager
+  if (m_memory_buffer and m_memory_buffer->poisoning()) {
+    m_atm_logger->info("[EAMxx::finalize] " + m_memory_buffer->usage_report());
+  }
   m_memory_buffer = nullptr;
 
   // Destroy the surface coupling data managers
@@ -1847,7 +1878,7 @@ void AtmosphereDriver::report_res_dep_memory_footprint () const {
     my_dev_mem_usage += sizeof(Real)*geo_names.size()*nldofs;
   }
   // Atm buffer
-  my_dev_mem_usage += m_memory_buffer->allocated_bytes();
+  my_dev_mem_usage += m_memory_buffer->total_allocated_bytes();
   // Output
   if (m_restart_output_manager) {
     const auto om_footprint = m_restart_output_manager->res_dep_memory_footprint();
@@ -306,6 +306,13 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   EKAT_REQUIRE_MSG(m_num_scream_exports = m_num_from_file_exports+m_num_const_exports+m_num_from_model_exports,"Error! surface_coupling_exporter - Something went wrong set the type of export for all variables.");
   EKAT_REQUIRE_MSG(m_num_from_model_exports>=0,"Error! surface_coupling_exporter - The number of exports derived from EAMxx < 0, something must have gone wrong in assigning the types of exports for all variables.");
 
+  // Constant exports never change, so set them once here
+  if (m_num_const_exports>0) {
+    set_constant_exports();
+  }
+
+  setup_transfer_plan();
+
   // Perform initial export (if any are marked for export during initialization)
   if (any_initial_exports) do_export(0, true);
 }
@@ -315,12 +322,48 @@ void SurfaceCouplingExporter::run_impl (const double dt)
   do_export(dt);
 }
 // =========================================================================================
-void SurfaceCouplingExporter::do_export(const double dt, const bool called_during_initialization)
+void SurfaceCouplingExporter::setup_transfer_plan()
 {
-  if (m_num_const_exports>0) {
-    set_constant_exports();
-  }
+  // Exports that are copies of atm surface fields
+  const std::map<std::string,std::string> surface_copies = {
+    {"Faxa_swndr", "sfc_flux_dir_nir"},
+    {"Faxa_swvdr", "sfc_flux_dir_vis"},
+    {"Faxa_swndf", "sfc_flux_dif_nir"},
+    {"Faxa_swvdf", "sfc_flux_dif_vis"},
+    {"Faxa_swnet", "sfc_flux_sw_net"},
+    {"Faxa_lwdn",  "sfc_flux_lw_dn"}
+  };
+
+  m_cpl_to_export_d = view_1d<DefaultDevice,int>("cpl_to_export",m_num_cpl_exports);
+  auto cpl_to_export_h = Kokkos::create_mirror_view(m_cpl_to_export_d);
+  Kokkos::deep_copy(cpl_to_export_h,-1);
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    const std::string fname = m_export_field_names[i];
+    auto& info = m_column_info_h(i);
+
+    if (m_export_source_h(i)==FROM_MODEL and surface_copies.count(fname)==1) {
+      // Read directly from the atm field. Since the field is only "Required",
+      // we must use the unsafe version of the get_internal_view_data().
+      const auto& src = get_field_in(surface_copies.at(fname));
+      info.data = src.get_internal_view_data_unsafe<Real>();
+      get_col_info_for_surface_values(src.get_header_ptr(),
+                                      m_vector_components_view(i),
+                                      info.col_offset,
+                                      info.col_stride);
+    }
 
+    EKAT_REQUIRE_MSG(cpl_to_export_h(info.cpl_indx)==-1,
+                     "Error! Multiple exports target the same cpl field.\n"
+                     " - export name: " + fname + "\n"
+                     " - cpl index  : " + std::to_string(info.cpl_indx) + "\n");
+    cpl_to_export_h(info.cpl_indx) = i;
+  }
+  Kokkos::deep_copy(m_cpl_to_export_d, cpl_to_export_h);
+  Kokkos::deep_copy(m_column_info_d, m_column_info_h);
+}
+// =========================================================================================
+void SurfaceCouplingExporter::do_export(const double dt, const bool called_during_initialization)
+{
   if (m_num_from_file_exports>0) {
     set_from_file_exports();
   }
@@ -376,12 +419,6 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
   const auto& horiz_winds          = get_field_in("horiz_winds").get_view<const Real***>();
   const auto& p_mid                = get_field_in("p_mid").get_view<const Pack**>();
   const auto& phis                 = get_field_in("phis").get_view<const Real*>();
-  const auto& sfc_flux_dir_nir     = get_field_in("sfc_flux_dir_nir").get_view<const Real*>();
-  const auto& sfc_flux_dir_vis     = get_field_in("sfc_flux_dir_vis").get_view<const Real*>();
-  const auto& sfc_flux_dif_nir     = get_field_in("sfc_flux_dif_nir").get_view<const Real*>();
-  const auto& sfc_flux_dif_vis     = get_field_in("sfc_flux_dif_vis").get_view<const Real*>();
-  const auto& sfc_flux_sw_net      = get_field_in("sfc_flux_sw_net" ).get_view<const Real*>();
-  const auto& sfc_flux_lw_dn       = get_field_in("sfc_flux_lw_dn"  ).get_view<const Real*>();
 
   const auto& precip_liq_surf_mass = get_field_in("precip_liq_surf_mass").get_view<const Real*>();
   const auto& precip_ice_surf_mass = get_field_in("precip_ice_surf_mass").get_view<const Real*>();
@@ -397,12 +434,6 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
   const auto Sa_pslv    = m_helper_fields.at("Sa_pslv").get_view<Real*>();
   const auto Faxa_rainl = m_helper_fields.at("Faxa_rainl").get_view<Real*>();
   const auto Faxa_snowl = m_helper_fields.at("Faxa_snowl").get_view<Real*>();
-  const auto Faxa_swndr = m_helper_fields.at("Faxa_swndr").get_view<Real*>();
-  const auto Faxa_swvdr = m_helper_fields.at("Faxa_swvdr").get_view<Real*>();
-  const auto Faxa_swndf = m_helper_fields.at("Faxa_swndf").get_view<Real*>();
-  const auto Faxa_swvdf = m_helper_fields.at("Faxa_swvdf").get_view<Real*>();
-  const auto Faxa_swnet = m_helper_fields.at("Faxa_swnet").get_view<Real*>();
-  const auto Faxa_lwdn  = m_helper_fields.at("Faxa_lwdn" ).get_view<Real*>();
 
   const auto dz    = m_buffer.dz;
   const auto z_int = m_buffer.z_int;
@@ -420,12 +451,6 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
   int idx_Sa_pslv    =  8;
   int idx_Faxa_rainl =  9;
   int idx_Faxa_snowl = 10;
-  int idx_Faxa_swndr = 11;
-  int idx_Faxa_swvdr = 12;
-  int idx_Faxa_swndf = 13;
-  int idx_Faxa_swvdf = 14;
-  int idx_Faxa_swnet = 15;
-  int idx_Faxa_lwdn  = 16;
 
 
   // Local copies, to deal with CUDA's handling of *this.
@@ -531,45 +556,49 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
       if (export_source(idx_Faxa_snowl)==FROM_MODEL) { Faxa_snowl(i) = precip_ice_surf_mass(i)/dt*(1000.0/PC::RHO_H2O.value); }
     }
   });
-  // Variables that are already surface vars in the ATM can just be copied directly.
-  if (m_export_source_h(idx_Faxa_swndr)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swndr, sfc_flux_dir_nir); }
-  if (m_export_source_h(idx_Faxa_swvdr)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swvdr, sfc_flux_dir_vis); }
-  if (m_export_source_h(idx_Faxa_swndf)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swndf, sfc_flux_dif_nir); }
-  if (m_export_source_h(idx_Faxa_swvdf)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swvdf, sfc_flux_dif_vis); }
-  if (m_export_source_h(idx_Faxa_swnet)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swnet, sfc_flux_sw_net); }
-  if (m_export_source_h(idx_Faxa_lwdn )==FROM_MODEL) { Kokkos::deep_copy(Faxa_lwdn,  sfc_flux_lw_dn); }
+  // Variables that are already surface vars in the ATM are not copied: their
+  // column info points directly to the ATM field (see setup_transfer_plan).
 
 }
 // =========================================================================================
 void SurfaceCouplingExporter::do_export_to_cpl(const bool called_during_initialization)
 {
   using policy_type = KT::RangePolicy;
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
   const auto cpl_exports_view_d = m_cpl_exports_view_d;
-  const int  num_exports        = m_num_scream_exports;
+  const auto cpl_to_export      = m_cpl_to_export_d;
+  const int  num_cpl_exports    = m_num_cpl_exports;
   const int  num_cols           = m_num_cols;
   const auto col_info           = m_column_info_d;
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
+  // Export to cpl data. We loop over all cpl entries, in the order in which
+  // they are stored, so that we can set to 0.0 any field not exported by
+  // scream (or not exported during initialization) in the same kernel.
+  auto export_policy   = policy_type (0,num_cpl_exports*num_cols);
   Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
-
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
 #ifdef HAVE_MOAB
-      cpl_exports_view_d(info.cpl_indx, icol) = info.constant_multiple*info.data[offset];
+    const int icpl = i / num_cols;
+    const int icol = i % num_cols;
 #else
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
+    const int icol = i / num_cpl_exports;
+    const int icpl = i % num_cpl_exports;
 #endif
+    Real value = 0;
+    const int ifield = cpl_to_export(icpl);
+    if (ifield>=0) {
+      const auto& info = col_info(ifield);
+      // if this is during initialization, check whether or not the field should be exported
+      bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+      if (do_export) {
+        value = info.constant_multiple*info.data[icol*info.col_stride + info.col_offset];
+      }
     }
+#ifdef HAVE_MOAB
+    cpl_exports_view_d(icpl, icol) = value;
+#else
+    cpl_exports_view_d(icol, icpl) = value;
+#endif
   });
-  // Deep copy fields from device to cpl host array
+  // Deep copy fields from device to cpl host array. If the device can access
+  // host memory, the two views alias each other and this is a no-op.
   Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
 
 }
@@ -107,6 +107,10 @@ protected:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
+  // Once the source of every export is known, finalize the column info of each
+  // export and build the map from cpl fields to exports used by do_export_to_cpl
+  void setup_transfer_plan();
+
   std::shared_ptr<const AbstractGrid> m_grid;
 
   // Keep track of field dimensions and the iteration count
@@ -153,6 +157,9 @@ protected:
   view_1d<DefaultDevice, SurfaceCouplingColumnInfo> m_column_info_d;
   decltype(m_column_info_d)::HostMirror             m_column_info_h;
 
+  // For each cpl field, the index of the export that sets it (-1 if none)
+  view_1d<DefaultDevice, int> m_cpl_to_export_d;
+
 }; // class SurfaceCouplingExporter
 
 } // namespace scream
@@ -103,6 +103,11 @@ void SurfaceCouplingImporter::create_requests()
 
   m_column_info_d = decltype(m_column_info_d) ("m_info", m_num_scream_imports);
   m_column_info_h = Kokkos::create_mirror_view(m_column_info_d);
+
+  m_iop_overrides_d = decltype(m_iop_overrides_d) ("iop_overrides", m_num_scream_imports);
+  m_iop_overrides_h = Kokkos::create_mirror_view(m_iop_overrides_d);
+  m_iop_override_flags_d = decltype(m_iop_override_flags_d) ("iop_override_flags", m_num_scream_imports);
+  m_iop_override_flags_h = Kokkos::create_mirror_view(m_iop_override_flags_d);
 }
 // =========================================================================================
 void SurfaceCouplingImporter::initialize_impl (const RunType /* run_type */)
@@ -156,13 +161,23 @@ void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
 {
   using policy_type = KokkosTypes<DefaultDevice>::RangePolicy;
 
+  if (m_iop_data_manager) {
+    if (m_iop_data_manager->get_params().get<bool>("iop_srf_prop")) {
+      // Overwrite imports with data from IOP file
+      set_iop_import_overrides(called_during_initialization);
+    }
+  }
+
   // Local copies, to deal with CUDA's handling of *this
   const auto col_info           = m_column_info_d;
   const auto cpl_imports_view_d = m_cpl_imports_view_d;
+  const auto iop_overrides      = m_iop_overrides_d;
+  const auto iop_override_flags = m_iop_override_flags_d;
   const int  num_cols           = m_num_cols;
   const int  num_imports        = m_num_scream_imports;
 
-  // Deep copy cpl host array to device
+  // Deep copy cpl host array to device. If the device can access host memory,
+  // the two views alias each other and this is a no-op.
   Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
 
   // Unpack the fields
@@ -178,25 +193,21 @@ void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
     // if this is during initialization, check whether or not the field should be imported
     bool do_import = (not called_during_initialization || info.transfer_during_initialization);
     if (do_import) {
+      if (iop_override_flags(ifield)!=0) {
+        info.data[offset] = iop_overrides(ifield);
+      } else {
 #ifdef HAVE_MOAB
-      info.data[offset] = cpl_imports_view_d(info.cpl_indx, icol)*info.constant_multiple;
+        info.data[offset] = cpl_imports_view_d(info.cpl_indx, icol)*info.constant_multiple;
 #else
-      info.data[offset] = cpl_imports_view_d(icol,info.cpl_indx)*info.constant_multiple;
+        info.data[offset] = cpl_imports_view_d(icol,info.cpl_indx)*info.constant_multiple;
 #endif
+      }
     }
   });
-
-  if (m_iop_data_manager) {
-    if (m_iop_data_manager->get_params().get<bool>("iop_srf_prop")) {
-      // Overwrite imports with data from IOP file
-      overwrite_iop_imports(called_during_initialization);
-    }
-  }
 }
 // =========================================================================================
-void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_initialization)
+void SurfaceCouplingImporter::set_iop_import_overrides (const bool called_during_initialization)
 {
-  using policy_type = KokkosTypes<DefaultDevice>::RangePolicy;
   using C = physics::Constants<Real>;
 
   const auto has_lhflx = m_iop_data_manager->has_iop_field("lhflx");
@@ -211,11 +222,11 @@ void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_in
   static constexpr Real stebol = C::stebol.value;
 
   const auto& col_info_h = m_column_info_h;
-  const auto& col_info_d = m_column_info_d;
 
   for (int ifield=0; ifield<m_num_scream_imports; ++ifield) {
     const std::string fname = m_import_field_names[ifield];
     const auto& info_h = col_info_h(ifield);
+    m_iop_override_flags_h(ifield) = 0;
 
     // If we are in initialization and field should not be imported, skip
     if (called_during_initialization && not info_h.transfer_during_initialization) {
@@ -246,13 +257,11 @@ void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_in
     }
 
     // Overwrite iop imports with col_val for each column
-    auto policy = policy_type(0, m_num_cols);
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& icol) {
-      const auto& info_d = col_info_d(ifield);
-      const auto offset = icol*info_d.col_stride + info_d.col_offset;
-      info_d.data[offset] = col_val;
-    });
+    m_iop_overrides_h(ifield) = col_val;
+    m_iop_override_flags_h(ifield) = 1;
   }
+  Kokkos::deep_copy(m_iop_overrides_d, m_iop_overrides_h);
+  Kokkos::deep_copy(m_iop_override_flags_d, m_iop_override_flags_h);
 }
 // =========================================================================================
 void SurfaceCouplingImporter::finalize_impl()
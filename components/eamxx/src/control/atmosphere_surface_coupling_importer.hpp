@@ -59,8 +59,8 @@ public:
   // Take and store data from SCDataManager
   void setup_surface_coupling_data(const SCDataManager &sc_data_manager);
 
-  // Overwrite imports for IOP cases with IOP file surface data
-  void overwrite_iop_imports (const bool called_during_initialization);
+  // For IOP cases, compute the IOP file surface data that overwrites imports
+  void set_iop_import_overrides (const bool called_during_initialization);
 
 protected:
 
@@ -97,6 +97,14 @@ protected:
   view_1d<DefaultDevice, SurfaceCouplingColumnInfo> m_column_info_d;
   decltype(m_column_info_d)::HostMirror             m_column_info_h;
 
+  // Per-import value replacing the cpl data in all columns, applied only where the
+  // matching flag is nonzero. Used for IOP cases, so that overrides are applied
+  // within the unpack kernel.
+  view_1d<DefaultDevice, Real>          m_iop_overrides_d;
+  decltype(m_iop_overrides_d)::HostMirror m_iop_overrides_h;
+  view_1d<DefaultDevice, int>           m_iop_override_flags_d;
+  decltype(m_iop_override_flags_d)::HostMirror m_iop_override_flags_h;
+
   // The grid is needed for property checks
   std::shared_ptr<const AbstractGrid> m_grid;
 }; // class SurfaceCouplingImporter
@@ -16,88 +16,51 @@ extern "C" void cosp_c2f_run(const int ncol, const int nsubcol, const int nlay,
 namespace scream {
 
     namespace CospFunc {
-        using lview_host_1d = typename ekat::KokkosTypes<HostDevice>::template lview<Real*  >;
-        using lview_host_2d = typename ekat::KokkosTypes<HostDevice>::template lview<Real** >;
-        using lview_host_3d = typename ekat::KokkosTypes<HostDevice>::template lview<Real***>;
-        template <typename S>
-        using view_1d = typename ekat::KokkosTypes<HostDevice>::template view_1d<S>;
-        template <typename S>
-        using view_2d = typename ekat::KokkosTypes<HostDevice>::template view_2d<S>;
-        template <typename S>
-        using view_3d = typename ekat::KokkosTypes<HostDevice>::template view_3d<S>;
-
         inline void initialize(int ncol, int nsubcol, int nlay) {
             cosp_c2f_init(ncol, nsubcol, nlay);
         };
         inline void finalize() {
             cosp_c2f_final();
         };
-        inline void main(
-                const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
-                const view_1d<const Real>& sunlit , const view_1d<const Real>& skt,
-                const view_2d<const Real>& T_mid  , const view_2d<const Real>& p_mid  ,
-                const view_2d<const Real>& p_int,  const view_2d<const Real>& z_mid,
-                const view_2d<const Real>& qv     , const view_2d<const Real>& qc,
-                const view_2d<const Real>& qi, const view_2d<const Real>& cldfrac,
-                const view_2d<const Real>& reff_qc, const view_2d<const Real>& reff_qi,
-                const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105,
-                const view_1d<Real>& isccp_cldtot , const view_3d<Real>& isccp_ctptau,
-                const view_3d<Real>& modis_ctptau, const view_3d<Real>& misr_cthtau) {
 
-            // Make host copies and permute data as needed
-            lview_host_2d
-                  T_mid_h("T_mid_h", ncol, nlay), p_mid_h("p_mid_h", ncol, nlay), p_int_h("p_int_h", ncol, nlay+1),
-                  z_mid_h("z_mid_h", ncol, nlay), qv_h("qv_h", ncol, nlay), qc_h("qc_h", ncol, nlay), qi_h("qi_h", ncol, nlay),
-                  cldfrac_h("cldfrac_h", ncol, nlay),
-                  reff_qc_h("reff_qc_h", ncol, nlay), reff_qi_h("reff_qi_h", ncol, nlay),
-                  dtau067_h("dtau_067_h", ncol, nlay), dtau105_h("dtau105_h", ncol, nlay);
-            lview_host_3d isccp_ctptau_h("isccp_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d modis_ctptau_h("modis_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d misr_cthtau_h("misr_cthtau_h", ncol, ntau, ncth);
+        // Layout of the contiguous buffers exchanged with cosp_c2f_run. Only the ncol columns
+        // selected for simulation are packed, and every field is stored with the column index
+        // fastest, i.e., already in the Fortran order cosp_c2f_run expects, so the buffers can
+        // be filled on device and moved to host with a single copy.
+        struct PackedLayout {
+            enum Field2d { T_mid, p_mid, z_mid, qv, qc, qi, cldfrac, reff_qc, reff_qi, dtau067, dtau105, num_fields_2d };
 
-            // Copy to layoutLeft host views
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < nlay; j++) {
-                    T_mid_h(i,j) = T_mid(i,j);
-                    p_mid_h(i,j) = p_mid(i,j);
-                    z_mid_h(i,j) = z_mid(i,j);
-                    qv_h(i,j) = qv(i,j);
-                    qc_h(i,j) = qc(i,j);
-                    qi_h(i,j) = qi(i,j);
-                    cldfrac_h(i,j) = cldfrac(i,j);
-                    reff_qc_h(i,j) = reff_qc(i,j);
-                    reff_qi_h(i,j) = reff_qi(i,j);
-                    dtau067_h(i,j) = dtau067(i,j);
-                    dtau105_h(i,j) = dtau105(i,j);
-                }
-            }
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < nlay+1; j++) {
-                    p_int_h(i,j) = p_int(i,j);
-                }
-            }
+            int ncol, nlay, ntau, nctp, ncth;
 
-            // Subsample here?
+            // Inputs: the num_fields_2d (ncol,nlay) fields, then p_int, sunlit and skt
+            KOKKOS_INLINE_FUNCTION int field_2d (const int f) const { return f*ncol*nlay; }
+            KOKKOS_INLINE_FUNCTION int p_int    () const { return num_fields_2d*ncol*nlay; }
+            KOKKOS_INLINE_FUNCTION int sunlit   () const { return p_int() + ncol*(nlay+1); }
+            KOKKOS_INLINE_FUNCTION int skt      () const { return sunlit() + ncol; }
+            KOKKOS_INLINE_FUNCTION int in_size  () const { return skt() + ncol; }
 
-            // Call COSP wrapper
-            cosp_c2f_run(ncol, nsubcol, nlay, ntau, nctp, ncth,
-                    emsfc_lw, sunlit.data(), skt.data(), T_mid_h.data(), p_mid_h.data(), p_int_h.data(),
-                    z_mid_h.data(), qv_h.data(), qc_h.data(), qi_h.data(),
-                    cldfrac_h.data(), reff_qc_h.data(), reff_qi_h.data(), dtau067_h.data(), dtau105_h.data(),
-                    isccp_cldtot.data(), isccp_ctptau_h.data(), modis_ctptau_h.data(), misr_cthtau_h.data());
+            // Outputs: isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau
+            KOKKOS_INLINE_FUNCTION int isccp_cldtot () const { return 0; }
+            KOKKOS_INLINE_FUNCTION int isccp_ctptau () const { return ncol; }
+            KOKKOS_INLINE_FUNCTION int modis_ctptau () const { return isccp_ctptau() + ncol*ntau*nctp; }
+            KOKKOS_INLINE_FUNCTION int misr_cthtau  () const { return modis_ctptau() + ncol*ntau*nctp; }
+            KOKKOS_INLINE_FUNCTION int out_size     () const { return misr_cthtau() + ncol*ntau*ncth; }
+        };
 
-            // Copy outputs back to layoutRight views
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < ntau; j++) {
-                    for (int k = 0; k < nctp; k++) {
-                        isccp_ctptau(i,j,k) = isccp_ctptau_h(i,j,k);
-                        modis_ctptau(i,j,k) = modis_ctptau_h(i,j,k);
-                    }
-                    for (int k = 0; k < ncth; k++) {
-                        misr_cthtau(i,j,k) = misr_cthtau_h(i,j,k);
-                    }
-                }
-            }
+        // Run the simulators on packed host buffers laid out as described by PackedLayout.
+        // Must be called from the main thread: cosp_c2f_run uses module-level state and
+        // large automatic arrays.
+        inline void run_packed(const PackedLayout& l, const Int nsubcol, const Real emsfc_lw,
+                               const Real* in, Real* out) {
+            using PL = PackedLayout;
+            cosp_c2f_run(l.ncol, nsubcol, l.nlay, l.ntau, l.nctp, l.ncth, emsfc_lw,
+                    in + l.sunlit(), in + l.skt(),
+                    in + l.field_2d(PL::T_mid), in + l.field_2d(PL::p_mid), in + l.p_int(),
+                    in + l.field_2d(PL::z_mid), in + l.field_2d(PL::qv), in + l.field_2d(PL::qc),
+                    in + l.field_2d(PL::qi), in + l.field_2d(PL::cldfrac),
+                    in + l.field_2d(PL::reff_qc), in + l.field_2d(PL::reff_qi),
+                    in + l.field_2d(PL::dtau067), in + l.field_2d(PL::dtau105),
+                    out + l.isccp_cldtot(), out + l.isccp_ctptau(), out + l.modis_ctptau(), out + l.misr_cthtau());
         }
     }
 }
@@ -10,6 +10,8 @@
 #include <ekat_assert.hpp>
 #include <ekat_units.hpp>
 
+#include <random>
+
 namespace scream
 {
 // =========================================================================================
@@ -26,6 +28,19 @@ Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   // How many subcolumns to use for COSP
   m_num_subcols = m_params.get<Int>("cosp_subcolumns", 10);
+
+  // Which columns to simulate
+  m_column_mode     = m_params.get<std::string>("cosp_column_mode", "all");
+  m_column_stride   = m_params.get<int>("cosp_column_stride", 1);
+  m_column_fraction = m_params.get<double>("cosp_column_fraction", 1.0);
+  EKAT_REQUIRE_MSG(
+    (m_column_mode == "all") || (m_column_mode == "sunlit") ||
+    (m_column_mode == "strided") || (m_column_mode == "random"),
+    "cosp_column_mode " + m_column_mode + " not supported"
+  );
+  EKAT_REQUIRE_MSG(m_column_stride >= 1, "cosp_column_stride must be positive");
+  EKAT_REQUIRE_MSG(m_column_fraction > 0 && m_column_fraction <= 1,
+    "cosp_column_fraction must be in (0,1]");
 }
 
 // =========================================================================================
@@ -97,7 +112,7 @@ void Cosp::create_requests()
   // We can allocate these now
   m_z_mid = Field(FieldIdentifier("z_mid",scalar3d_mid,m,grid_name),true);
   m_z_int = Field(FieldIdentifier("z_int",scalar3d_int,m,grid_name),true);
-  m_sunlit_real = Field(FieldIdentifier("sunlit_mask_real",scalar2d,none,grid_name),true);
+  m_cosp_mask = Field(FieldIdentifier("cosp_mask",scalar2d,none,grid_name,DataType::IntType),true);
 }
 
 // =========================================================================================
@@ -121,8 +136,9 @@ void Cosp::initialize_impl (const RunType /* run_type */)
   FieldIdentifier mcth_fid ("sunlit_mask_cthtau", scalar4d_cthtau, none, m_grid->name(), DataType::IntType);
   Field mctp(mctp_fid,true);
   Field mcth(mcth_fid,true);
+  m_cosp_mask.deep_copy(0);
   std::map<std::string,Field> masks = {
-    {"isccp_cldtot", get_field_in("sunlit_mask")},
+    {"isccp_cldtot", m_cosp_mask},
     {"isccp_ctptau", mctp},
     {"modis_ctptau", mctp},
     {"misr_cthtau",  mcth},
@@ -130,7 +146,7 @@ void Cosp::initialize_impl (const RunType /* run_type */)
   // Set the mask field for each of the cosp computed fields
   std::list<std::string> vnames = {"isccp_cldtot", "isccp_ctptau", "modis_ctptau", "misr_cthtau"};
   for (const auto& field_name : vnames) {
-    // the mask here is just the sunlit mask, so set it
+    // the mask here is the sunlit mask restricted to the simulated columns, so set it
     auto& f = get_field_out(field_name);
 
     f.set_valid_mask(masks.at(field_name));
@@ -185,6 +201,15 @@ void Cosp::initialize_impl (const RunType /* run_type */)
   cosp_tau_f.get_header().get_extra_data<stratts_t>("io: string attributes")["bounds"] = "cosp_tau_bnds";
   cosp_prs_f.get_header().get_extra_data<stratts_t>("io: string attributes")["bounds"] = "cosp_prs_bnds";
   cosp_cth_f.get_header().get_extra_data<stratts_t>("io: string attributes")["bounds"] = "cosp_cth_bnds";
+
+  // Packed buffers, sized for the case where every column is simulated
+  m_layout = {m_num_cols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth};
+  m_cols       = view_1d<int>("cosp_cols", m_num_cols);
+  m_packed_in  = view_1d<Real>("cosp_packed_in", m_layout.in_size());
+  m_packed_out = view_1d<Real>("cosp_packed_out", m_layout.out_size());
+  m_cols_h       = Kokkos::create_mirror_view(m_cols);
+  m_packed_in_h  = Kokkos::create_mirror_view(m_packed_in);
+  m_packed_out_h = Kokkos::create_mirror_view(m_packed_out);
 }
 
 // =========================================================================================
@@ -209,27 +234,6 @@ void Cosp::run_impl (const double dt)
 
   // Call COSP wrapper routines
   if (update_cosp) {
-    // Get fields from field manager; note that we get host views because this
-    // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
-    // all then need to be copied to layoutLeft views to permute the indices for
-    // F90.
-
-    // Ensure host data of input fields is up to date
-    get_field_in("qv").sync_to_host();
-    get_field_in("qc").sync_to_host();
-    get_field_in("qi").sync_to_host();
-    get_field_in("surf_radiative_T").sync_to_host();
-    get_field_in("T_mid").sync_to_host();
-    get_field_in("p_mid").sync_to_host();
-    get_field_in("p_int").sync_to_host();
-    get_field_in("cldfrac_rad").sync_to_host();
-    get_field_in("eff_radius_qc").sync_to_host();
-    get_field_in("eff_radius_qi").sync_to_host();
-    get_field_in("dtau067").sync_to_host();
-    get_field_in("dtau105").sync_to_host();
-
-    m_sunlit_real.deep_copy(get_field_in("sunlit_mask"));
-    m_sunlit_real.sync_to_host();
     // Compute z_mid
     const auto T_mid_d = get_field_in("T_mid").get_view<const Real**>();
     const auto qv_d  = get_field_in("qv").get_view<const Real**>();
@@ -241,7 +245,6 @@ void Cosp::run_impl (const double dt)
     const auto ncol = m_num_cols;
     const auto nlev = m_num_levs;
 
-    using KT       = KokkosTypes<DefaultDevice>;
     using ExeSpace = typename KT::ExeSpace;
     using TPF      = ekat::TeamPolicyFactory<ExeSpace>;
     using PF       = scream::PhysicsFunctions<DefaultDevice>;
@@ -271,81 +274,188 @@ void Cosp::run_impl (const double dt)
         PF::calculate_z_mid(team,nlev,z_int_s,z_mid_s);
         team.team_barrier();
     });
-    Kokkos::fence();
-
-    m_z_mid.sync_to_host();
-    const auto z_mid_h = m_z_mid.get_view<const Real**,Host>();
-    const auto T_mid_h   = get_field_in("T_mid").get_view<const Real**, Host>();
-    const auto qv_h      = get_field_in("qv").get_view<const Real**, Host>();
-    const auto p_mid_h   = get_field_in("p_mid").get_view<const Real**,Host>();
-    const auto qc_h      = get_field_in("qc").get_view<const Real**, Host>();
-    const auto qi_h      = get_field_in("qi").get_view<const Real**, Host>();
-    const auto sunlit_h  = m_sunlit_real.get_view<const Real*, Host>();
-    const auto skt_h     = get_field_in("surf_radiative_T").get_view<const Real*, Host>();
-    const auto p_int_h   = get_field_in("p_int").get_view<const Real**, Host>();
-    const auto cldfrac_h = get_field_in("cldfrac_rad").get_view<const Real**, Host>();
-    const auto reff_qc_h = get_field_in("eff_radius_qc").get_view<const Real**, Host>();
-    const auto reff_qi_h = get_field_in("eff_radius_qi").get_view<const Real**, Host>();
-    const auto dtau067_h = get_field_in("dtau067").get_view<const Real**, Host>();
-    const auto dtau105_h = get_field_in("dtau105").get_view<const Real**, Host>();
-
-    auto isccp_cldtot_h = get_field_out("isccp_cldtot").get_view<Real*, Host>();
-    auto isccp_ctptau_h = get_field_out("isccp_ctptau").get_view<Real***, Host>();
-    auto modis_ctptau_h = get_field_out("modis_ctptau").get_view<Real***, Host>();
-    auto misr_cthtau_h  = get_field_out("misr_cthtau"). get_view<Real***, Host>();
-
-    Real emsfc_lw = 0.99;
-    CospFunc::main(
-            m_num_cols, m_num_subcols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth, emsfc_lw,
-            sunlit_h, skt_h, T_mid_h, p_mid_h, p_int_h, z_mid_h, qv_h, qc_h, qi_h,
-            cldfrac_h, reff_qc_h, reff_qi_h, dtau067_h, dtau105_h,
-            isccp_cldtot_h, isccp_ctptau_h, modis_ctptau_h, misr_cthtau_h
-    );
-    // Mask night values
-    constexpr auto fill_value = constants::fill_value<Real>;
-    for (int i = 0; i < m_num_cols; i++) {
-      if (sunlit_h(i) == 0) {
-        // if night, set to fill val
-        isccp_cldtot_h(i) = fill_value;
-        for (int j = 0; j < m_num_tau; j++) {
-          for (int k = 0; k < m_num_ctp; k++) {
-            isccp_ctptau_h(i,j,k) = fill_value;
-            modis_ctptau_h(i,j,k) = fill_value;
-          }
-          for (int k = 0; k < m_num_cth; k++) {
-            misr_cthtau_h (i,j,k) = fill_value;
-          }
-        }
-      }
+
+    // Only the selected columns are packed and shipped to host; this replaces syncing
+    // every input field to host in full
+    const int nstep = end_of_step_ts().get_num_steps();
+    select_columns(nstep, cosp_freq_in_steps>0 ? nstep/cosp_freq_in_steps : 0);
+    pack_inputs();
+
+    // The simulators run synchronously: cosp_c2f_run works on module-level state and
+    // large automatic arrays, which are not safe to use from another host thread
+    const Real emsfc_lw = 0.99;
+    if (m_layout.ncol > 0) {
+      CospFunc::run_packed(m_layout, m_num_subcols, emsfc_lw,
+                           m_packed_in_h.data(), m_packed_out_h.data());
+    }
+    publish_outputs();
+  }
+}
+
+// =========================================================================================
+void Cosp::select_columns (const int nstep, const int icall)
+{
+  const auto& sunlit = get_field_in("sunlit_mask");
+  sunlit.sync_to_host();
+  const auto sunlit_h = sunlit.get_view<const int*,Host>();
+
+  const int offset = icall % m_column_stride;
+  std::seed_seq seed {nstep, m_comm.rank()};
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<Real> uniform(0,1);
+
+  int nsel = 0;
+  for (int i = 0; i < m_num_cols; ++i) {
+    bool select;
+    if (m_column_mode == "all") {
+      // Night columns are simulated too, and masked out when publishing
+      select = true;
+    } else if (m_column_mode == "sunlit") {
+      select = sunlit_h(i) != 0;
+    } else if (m_column_mode == "strided") {
+      select = sunlit_h(i) != 0 && i % m_column_stride == offset;
+    } else {
+      select = sunlit_h(i) != 0 && uniform(engine) < m_column_fraction;
+    }
+    if (select) {
+      m_cols_h(nsel++) = i;
     }
+  }
+  m_layout.ncol = nsel;
+
+  const auto sel = std::make_pair(0,nsel);
+  Kokkos::deep_copy(Kokkos::subview(m_cols,sel), Kokkos::subview(m_cols_h,sel));
+}
 
-    // Make sure dev data is up to date
-    get_field_out("isccp_cldtot").sync_to_dev();
-    get_field_out("isccp_ctptau").sync_to_dev();
-    get_field_out("modis_ctptau").sync_to_dev();
-    get_field_out("misr_cthtau").sync_to_dev();
-
-    // Update the ctptau and cthtau masks by broadcasting sunlit mask
-    const auto& sunlit = get_field_in("sunlit_mask");
-    auto& ctptau = get_field_out("isccp_ctptau").get_valid_mask();
-    auto& cthtau = get_field_out("misr_cthtau").get_valid_mask();
-
-    auto sunlit_v = sunlit.get_view<const int*>();
-    auto ctptau_v = ctptau.get_view<int***>();
-    auto cthtau_v = cthtau.get_view<int***>();
-    auto do_ctp = KOKKOS_LAMBDA (int icol, int itau, int ictp) {
-      ctptau_v(icol,itau,ictp) = sunlit_v(icol);
-    };
-    auto do_cth = KOKKOS_LAMBDA (int icol, int itau, int icth) {
-      cthtau_v(icol,itau,icth) = sunlit_v(icol);
-    };
-    using exec_space = typename DefaultDevice::execution_space;
-    using policy_t = Kokkos::MDRangePolicy<exec_space,Kokkos::Rank<3>>;
-    policy_t policy_ctp({0,0,0},{m_num_cols,m_num_tau,m_num_ctp});
-    policy_t policy_cth({0,0,0},{m_num_cols,m_num_tau,m_num_cth});
-    Kokkos::parallel_for(policy_ctp,do_ctp);
-    Kokkos::parallel_for(policy_cth,do_cth);
+// =========================================================================================
+void Cosp::pack_inputs ()
+{
+  using PL = CospFunc::PackedLayout;
+
+  const auto layout  = m_layout;
+  const auto nlev    = m_num_levs;
+  const auto cols    = m_cols;
+  const auto in      = m_packed_in;
+  const auto sunlit  = get_field_in("sunlit_mask").get_view<const int*>();
+  const auto skt     = get_field_in("surf_radiative_T").get_view<const Real*>();
+  const auto p_int   = get_field_in("p_int").get_view<const Real**>();
+  const auto T_mid   = get_field_in("T_mid").get_view<const Real**>();
+  const auto p_mid   = get_field_in("p_mid").get_view<const Real**>();
+  const auto z_mid   = m_z_mid.get_view<const Real**>();
+  const auto qv      = get_field_in("qv").get_view<const Real**>();
+  const auto qc      = get_field_in("qc").get_view<const Real**>();
+  const auto qi      = get_field_in("qi").get_view<const Real**>();
+  const auto cldfrac = get_field_in("cldfrac_rad").get_view<const Real**>();
+  const auto reff_qc = get_field_in("eff_radius_qc").get_view<const Real**>();
+  const auto reff_qi = get_field_in("eff_radius_qi").get_view<const Real**>();
+  const auto dtau067 = get_field_in("dtau067").get_view<const Real**>();
+  const auto dtau105 = get_field_in("dtau105").get_view<const Real**>();
+
+  if (layout.ncol == 0) {
+    return;
   }
+
+  using exec_space = typename DefaultDevice::execution_space;
+  using policy_t = Kokkos::MDRangePolicy<exec_space,Kokkos::Rank<2>>;
+  policy_t policy({0,0},{layout.ncol,nlev+1});
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (int i, int k) {
+    const int icol = cols(i);
+    const int ik = k*layout.ncol + i;
+    in(layout.p_int() + ik) = p_int(icol,k);
+    if (k < nlev) {
+      in(layout.field_2d(PL::T_mid)   + ik) = T_mid(icol,k);
+      in(layout.field_2d(PL::p_mid)   + ik) = p_mid(icol,k);
+      in(layout.field_2d(PL::z_mid)   + ik) = z_mid(icol,k);
+      in(layout.field_2d(PL::qv)      + ik) = qv(icol,k);
+      in(layout.field_2d(PL::qc)      + ik) = qc(icol,k);
+      in(layout.field_2d(PL::qi)      + ik) = qi(icol,k);
+      in(layout.field_2d(PL::cldfrac) + ik) = cldfrac(icol,k);
+      in(layout.field_2d(PL::reff_qc) + ik) = reff_qc(icol,k);
+      in(layout.field_2d(PL::reff_qi) + ik) = reff_qi(icol,k);
+      in(layout.field_2d(PL::dtau067) + ik) = dtau067(icol,k);
+      in(layout.field_2d(PL::dtau105) + ik) = dtau105(icol,k);
+    }
+    if (k == 0) {
+      in(layout.sunlit() + i) = sunlit(icol);
+      in(layout.skt()    + i) = skt(icol);
+    }
+  });
+
+  const auto packed = std::make_pair(0,layout.in_size());
+  Kokkos::deep_copy(Kokkos::subview(m_packed_in_h,packed), Kokkos::subview(m_packed_in,packed));
+
+  // On host builds the mirror aliases the device buffer, so make sure packing is done
+  // before the simulators read it
+  Kokkos::fence();
+}
+
+// =========================================================================================
+void Cosp::publish_outputs ()
+{
+  const auto layout = m_layout;
+  const auto ntau   = m_num_tau;
+  const auto nctp   = m_num_ctp;
+  const auto ncth   = m_num_cth;
+  const auto cols   = m_cols;
+  const auto in     = m_packed_in;
+  const auto out    = m_packed_out;
+  const auto mask   = m_cosp_mask.get_view<int*>();
+
+  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*>();
+  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***>();
+  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***>();
+  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***>();
+
+  const auto packed = std::make_pair(0,layout.out_size());
+  Kokkos::deep_copy(Kokkos::subview(out,packed), Kokkos::subview(m_packed_out_h,packed));
+
+  // Columns that were not simulated, or are dark, get the fill value
+  constexpr auto fill_value = constants::fill_value<Real>;
+  get_field_out("isccp_cldtot").deep_copy(fill_value);
+  get_field_out("isccp_ctptau").deep_copy(fill_value);
+  get_field_out("modis_ctptau").deep_copy(fill_value);
+  get_field_out("misr_cthtau").deep_copy(fill_value);
+  m_cosp_mask.deep_copy(0);
+
+  // Only the packed columns are written; the sunlit flag is read back from the packed inputs
+  using exec_space = typename DefaultDevice::execution_space;
+  Kokkos::parallel_for(Kokkos::RangePolicy<exec_space>(0,layout.ncol), KOKKOS_LAMBDA (int i) {
+    if (in(layout.sunlit() + i) == 0) {
+      return;
+    }
+    const int icol = cols(i);
+    mask(icol) = 1;
+    isccp_cldtot(icol) = out(layout.isccp_cldtot() + i);
+    for (int j = 0; j < ntau; ++j) {
+      for (int k = 0; k < nctp; ++k) {
+        const int ijk = (k*ntau + j)*layout.ncol + i;
+        isccp_ctptau(icol,j,k) = out(layout.isccp_ctptau() + ijk);
+        modis_ctptau(icol,j,k) = out(layout.modis_ctptau() + ijk);
+      }
+      for (int k = 0; k < ncth; ++k) {
+        const int ijk = (k*ntau + j)*layout.ncol + i;
+        misr_cthtau(icol,j,k) = out(layout.misr_cthtau() + ijk);
+      }
+    }
+  });
+
+  // Update the ctptau and cthtau masks by broadcasting the cosp mask
+  auto& ctptau = get_field_out("isccp_ctptau").get_valid_mask();
+  auto& cthtau = get_field_out("misr_cthtau").get_valid_mask();
+
+  auto ctptau_v = ctptau.get_view<int***>();
+  auto cthtau_v = cthtau.get_view<int***>();
+  auto do_ctp = KOKKOS_LAMBDA (int icol, int itau, int ictp) {
+    ctptau_v(icol,itau,ictp) = mask(icol);
+  };
+  auto do_cth = KOKKOS_LAMBDA (int icol, int itau, int icth) {
+    cthtau_v(icol,itau,icth) = mask(icol);
+  };
+  using policy_t = Kokkos::MDRangePolicy<exec_space,Kokkos::Rank<3>>;
+  policy_t policy_ctp({0,0,0},{m_num_cols,m_num_tau,m_num_ctp});
+  policy_t policy_cth({0,0,0},{m_num_cols,m_num_tau,m_num_cth});
+  Kokkos::parallel_for(policy_ctp,do_ctp);
+  Kokkos::parallel_for(policy_cth,do_cth);
 }
 
 // =========================================================================================
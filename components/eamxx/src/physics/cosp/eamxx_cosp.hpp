@@ -2,6 +2,7 @@
 #define SCREAM_COSP_HPP
 
 #include "share/atm_process/atmosphere_process.hpp"
+#include "cosp_functions.hpp"
 
 #include <ekat_parameter_list.hpp>
 
@@ -54,9 +55,19 @@ protected:
 public:
 #endif
   void run_impl        (const double dt);
+
+  // Pack the selected columns of all inputs into m_packed_in, then copy them to host in one go
+  void pack_inputs ();
+
+  // Scatter the results in m_packed_out into the output fields and update the valid masks
+  void publish_outputs ();
 protected:
   void finalize_impl   ();
 
+  // Pick the columns to simulate this call, according to m_column_mode. icall is the
+  // index of this COSP call since the start of the simulation.
+  void select_columns (const int nstep, const int icall);
+
   // cosp frequency; positive is interpreted as number of steps, negative as number of hours
   int m_cosp_frequency;
   ekat::CaseInsensitiveString m_cosp_frequency_units;
@@ -71,10 +82,33 @@ protected:
 
   std::shared_ptr<const AbstractGrid> m_grid;
 
+  // Which columns to simulate: all, sunlit, strided (every m_column_stride-th sunlit column,
+  // rotating the offset between calls) or random (each sunlit column with probability
+  // m_column_fraction). Columns that are not simulated are filled and masked out.
+  // The selection only depends on the timestep, so restarted runs select the same columns.
+  ekat::CaseInsensitiveString m_column_mode;
+  int  m_column_stride;
+  Real m_column_fraction;
+
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+
+  // Selected columns and the packed input/output buffers (with their host mirrors)
+  CospFunc::PackedLayout m_layout;
+  view_1d<int>  m_cols;
+  view_1d<Real> m_packed_in;
+  view_1d<Real> m_packed_out;
+  typename view_1d<int>::HostMirror  m_cols_h;
+  typename view_1d<Real>::HostMirror m_packed_in_h;
+  typename view_1d<Real>::HostMirror m_packed_out_h;
+
   // TODO: use atm buffer instead
   Field m_z_mid;
   Field m_z_int;
-  Field m_sunlit_real;
+
+  // 1 where the COSP outputs are valid, i.e., the column is sunlit and was simulated
+  Field m_cosp_mask;
 }; // class Cosp
 
 } // namespace scream
@@ -13,11 +13,61 @@ MAMGenericInterface::MAMGenericInterface(const ekat::Comm &comm,
                                          const ekat::ParameterList &params)
     : AtmosphereProcess(comm, params) {
       use_prescribed_ozone_   = m_params.get<bool>("use_mam4_precribed_ozone", false);
+      reuse_dry_aero_state_   = m_params.get<bool>("reuse_dry_aerosol_state", false);
   /* Anything that can be initialized without grid information can be
    * initialized here. Like universal constants, mam wetscav options.
    */
 }
 // ================================================================
+std::shared_ptr<MAMGenericInterface::SharedDryAeroState>
+MAMGenericInterface::get_shared_dry_aero_state() {
+  if(shared_dry_aero_) {
+    return shared_dry_aero_;
+  }
+  // Only hold a weak reference here, so that the views are released together
+  // with the last process using them (i.e., before Kokkos is finalized)
+  static std::weak_ptr<SharedDryAeroState> s_shared;
+  shared_dry_aero_ = s_shared.lock();
+  if(shared_dry_aero_) {
+    const auto &v = shared_dry_aero_->dry_aero.int_aero_nmr[0];
+    EKAT_REQUIRE_MSG(
+        int(v.extent(0)) == ncol_ and int(v.extent(1)) == nlev_,
+        "Error! MAM4xx processes sharing the dry aerosol state must run on "
+        "the same grid.\n"
+        "  - process: " + name() + "\n"
+        "  - shared state extents: (" + std::to_string(v.extent(0)) + "," +
+            std::to_string(v.extent(1)) + ")\n"
+        "  - process extents: (" + std::to_string(ncol_) + "," +
+            std::to_string(nlev_) + ")\n");
+    return shared_dry_aero_;
+  }
+
+  shared_dry_aero_ = std::make_shared<SharedDryAeroState>();
+  auto &dry_aero   = shared_dry_aero_->dry_aero;
+  for(int m = 0; m < mam_coupling::num_aero_modes(); ++m) {
+    dry_aero.int_aero_nmr[m] =
+        mam_coupling::view_2d("dry_int_aero_nmr_" + std::to_string(m), ncol_, nlev_);
+    dry_aero.cld_aero_nmr[m] =
+        mam_coupling::view_2d("dry_cld_aero_nmr_" + std::to_string(m), ncol_, nlev_);
+    for(int a = 0; a < mam_coupling::num_aero_species(); ++a) {
+      if(not mam_coupling::int_aero_mmr_field_name(m, a).empty()) {
+        dry_aero.int_aero_mmr[m][a] = mam_coupling::view_2d(
+            "dry_" + mam_coupling::int_aero_mmr_field_name(m, a), ncol_, nlev_);
+      }
+      if(not mam_coupling::cld_aero_mmr_field_name(m, a).empty()) {
+        dry_aero.cld_aero_mmr[m][a] = mam_coupling::view_2d(
+            "dry_" + mam_coupling::cld_aero_mmr_field_name(m, a), ncol_, nlev_);
+      }
+    }
+  }
+  for(int g = 0; g < mam_coupling::num_aero_gases(); ++g) {
+    dry_aero.gas_mmr[g] = mam_coupling::view_2d(
+        "dry_" + std::string(mam_coupling::gas_mmr_name[g]), ncol_, nlev_);
+  }
+  s_shared = shared_dry_aero_;
+  return shared_dry_aero_;
+}
+// ================================================================
 void MAMGenericInterface::set_aerosol_and_gas_ranges() {
   // NOTE: Using only one range for all num variables.
   // std::map<std::string, std::pair<Real, Real>> limits_aerosol_gas_tracers_;
@@ -230,14 +280,20 @@ void MAMGenericInterface::populate_cloudborne_dry_aero(
   // number (n) mixing ratios
   for(int m = 0; m < mam_coupling::num_aero_modes(); ++m) {
     // cloudborne aerosol tracers of interest: number (n) mixing ratios
-    dry_aero.cld_aero_nmr[m] = buffer.dry_cld_aero_nmr[m];
+    dry_aero.cld_aero_nmr[m] =
+        reuse_dry_aero_state_
+            ? get_shared_dry_aero_state()->dry_aero.cld_aero_nmr[m]
+            : mam_coupling::view_2d(buffer.dry_cld_aero_nmr[m]);
 
     for(int a = 0; a < mam_coupling::num_aero_species(); ++a) {
       // (cloudborne) aerosol tracers of interest: mass (q) mixing ratios
       const std::string cld_mmr_field_name =
           mam_coupling::cld_aero_mmr_field_name(m, a);
       if(not cld_mmr_field_name.empty()) {
-        dry_aero.cld_aero_mmr[m][a] = buffer.dry_cld_aero_mmr[m][a];
+        dry_aero.cld_aero_mmr[m][a] =
+            reuse_dry_aero_state_
+                ? get_shared_dry_aero_state()->dry_aero.cld_aero_mmr[m][a]
+                : mam_coupling::view_2d(buffer.dry_cld_aero_mmr[m][a]);
       }
     }
   }
@@ -263,7 +319,10 @@ void MAMGenericInterface::set_field_w_scratch_buffer(
 void MAMGenericInterface::populate_gases_dry_aero(
     mam_coupling::AerosolState &dry_aero, mam_coupling::Buffer &buffer) {
   for(int g = 0; g < mam_coupling::num_aero_gases(); ++g) {
-    dry_aero.gas_mmr[g] = buffer.dry_gas_mmr[g];
+    dry_aero.gas_mmr[g] =
+        reuse_dry_aero_state_
+            ? get_shared_dry_aero_state()->dry_aero.gas_mmr[g]
+            : mam_coupling::view_2d(buffer.dry_gas_mmr[g]);
   }
 }
 // ================================================================
@@ -288,7 +347,10 @@ void MAMGenericInterface::populate_interstitial_dry_aero(
   // number (n) mixing ratios
   for(int m = 0; m < mam_coupling::num_aero_modes(); ++m) {
     // interstitial aerosol tracers of interest: number (n) mixing ratios
-    dry_aero.int_aero_nmr[m] = buffer.dry_int_aero_nmr[m];
+    dry_aero.int_aero_nmr[m] =
+        reuse_dry_aero_state_
+            ? get_shared_dry_aero_state()->dry_aero.int_aero_nmr[m]
+            : mam_coupling::view_2d(buffer.dry_int_aero_nmr[m]);
 
     for(int a = 0; a < mam_coupling::num_aero_species(); ++a) {
       // (interstitial) aerosol tracers of interest: mass (q) mixing ratios
@@ -296,7 +358,10 @@ void MAMGenericInterface::populate_interstitial_dry_aero(
           mam_coupling::int_aero_mmr_field_name(m, a);
 
       if(not int_mmr_field_name.empty()) {
-        dry_aero.int_aero_mmr[m][a] = buffer.dry_int_aero_mmr[m][a];
+        dry_aero.int_aero_mmr[m][a] =
+            reuse_dry_aero_state_
+                ? get_shared_dry_aero_state()->dry_aero.int_aero_mmr[m][a]
+                : mam_coupling::view_2d(buffer.dry_int_aero_mmr[m][a]);
       }
     }
   }
@@ -470,13 +535,22 @@ void MAMGenericInterface::pre_process(mam_coupling::AerosolState &wet_aero,
                                       mam_coupling::DryAtmosphere &dry_atm) {
   using TPF = ekat::TeamPolicyFactory<KT::ExeSpace>;
   const auto scan_policy = TPF::get_thread_range_parallel_scan_team_policy(ncol_, nlev_);
+  // If the MAM4xx process that ran right before this one left the shared dry
+  // aerosol state consistent with the wet fields, there is no need to convert
+  // the aerosols again. Non-MAM4xx processes bump the run counter, so any
+  // process in between forces a fresh conversion.
+  const bool convert_aero =
+      not reuse_dry_aero_state_ or
+      get_shared_dry_aero_state()->consistent_at_run < num_runs_started() - 1;
   Kokkos::parallel_for(
       scan_policy, KOKKOS_LAMBDA(const ThreadTeam &team) {
         const int i = team.league_rank();  // column index
 
         mam_coupling::compute_dry_mixing_ratios(team, wet_atm, dry_atm, i);
-        mam_coupling::compute_dry_mixing_ratios(team, wet_atm, wet_aero,
-                                                dry_aero, i);
+        if(convert_aero) {
+          mam_coupling::compute_dry_mixing_ratios(team, wet_atm, wet_aero,
+                                                  dry_aero, i);
+        }
         team.team_barrier();
         // vertical heights has to be computed after computing dry mixing ratios
         // for atmosphere
@@ -497,5 +571,8 @@ void MAMGenericInterface::post_process(mam_coupling::AerosolState &wet_aero,
         const int i = team.league_rank();  // column index
         compute_wet_mixing_ratios(team, dry_atm, dry_aero, wet_aero, i);
       });
+  if(reuse_dry_aero_state_) {
+    get_shared_dry_aero_state()->consistent_at_run = num_runs_started();
+  }
 }
 }  // namespace scream
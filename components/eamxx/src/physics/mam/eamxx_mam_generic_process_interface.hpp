@@ -5,6 +5,7 @@
 #include <share/atm_process/atmosphere_process.hpp>
 // For MAM4 aerosol configuration
 #include <physics/mam/mam_coupling.hpp>
+#include <memory>
 #include <string>
 /* We implemented the MAMGenericInterface class to eliminate duplicate code in
 the MAM4xx processes. Consequently, all MAM4xx processes must derive from this
@@ -77,8 +78,24 @@ class MAMGenericInterface : public scream::AtmosphereProcess {
 
   //namelist variables (declared protected so that derived classes can access them)
   bool use_prescribed_ozone_{false};  // use prescribed ozone from MAM4
+  // If true, the dry aerosol state lives in views shared by all MAM4xx
+  // processes (rather than in the process buffer), and pre_process skips the
+  // wet-to-dry aerosol conversion when the MAM4xx process that ran right
+  // before this one left the shared dry state consistent with the wet fields.
+  bool reuse_dry_aero_state_{false};
 
  private:
+  // Dry aerosol state shared by the MAM4xx processes that reuse it
+  struct SharedDryAeroState {
+    mam_coupling::AerosolState dry_aero;
+    // Value of AtmosphereProcess::num_runs_started() during the post_process
+    // that last made the wet fields consistent with dry_aero (-1 if none)
+    std::int64_t consistent_at_run = -1;
+  };
+  // Lazily creates the shared state (on first call); later calls check
+  // that the column/level extents match.
+  std::shared_ptr<SharedDryAeroState> get_shared_dry_aero_state();
+  std::shared_ptr<SharedDryAeroState> shared_dry_aero_;
   // The type of subcomponent
   // --------------------------------------------------------------------------
   // AtmosphereProcess overrides (see share/atm_process/atmosphere_process.hpp)
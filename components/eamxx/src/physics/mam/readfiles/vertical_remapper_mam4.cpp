@@ -2,6 +2,8 @@
 #include "share/scorpio_interface/eamxx_scorpio_interface.hpp"
 #include <mam4xx/mam4.hpp>
 
+#include <algorithm>
+
 namespace scream
 {
 VerticalRemapperMAM4::
@@ -15,6 +17,14 @@ VerticalRemapperMAM4 (const grid_ptr_type& src_grid,
 
 void VerticalRemapperMAM4::remap_fwd_impl ()
 {
+  if (m_vremap_type == MAM4_ELEVATED_EMISSIONS) {
+    // All sectors of a species share the src/tgt altitudes, so remap
+    // them together rather than launching one kernel per sector
+    for (int first=0; first<m_num_fields; first+=max_batched_fields) {
+      apply_elevated_emissions_rebin(first,std::min(max_batched_fields,m_num_fields-first));
+    }
+    return;
+  }
   for (int i=0; i<m_num_fields; ++i) {
     const auto& f_src    = m_src_fields[i];
           auto& f_tgt    = m_tgt_fields[i];
@@ -104,34 +114,53 @@ apply_vertical_interpolation(const Field& f_src, const Field& f_tgt,
             team, levsiz, nlevs_tgt, p_src_c, pmid_at_icol, datain_at_icol,
             dataout_at_icol, unit_factor_pin);
           });
-  } else if (m_vremap_type == MAM4_ELEVATED_EMISSIONS)
-  {
-      const auto src_x = p_src.get_view<const Real *>();
-      const int pverp=nlevs_tgt+1;
-      //FIXME: get this values from grid.
-      constexpr int nlev = mam4::nlev;
-      constexpr Real m2km    = 1e-3;
-      Kokkos::parallel_for(
-      "vert_interpolation_elevated_emissions", policy,
-      KOKKOS_LAMBDA(const Team &team) {
-        const int icol = team.league_rank();
-        const auto datain_at_icol  = ekat::subview(datain, icol);
-        const auto dataout_at_icol = ekat::subview(dataout, icol);
+  }
+}
 
-        // FIXME: Try to avoid copy of trg_x by modifying rebin
-        // trg_x
-        Real trg_x[nlev + 1];
-        // I am trying to do this:
-        // model_z(1:pverp) = m2km * state(c)%zi(i,pverp:1:-1)
-        for(int i = 0; i < pverp; ++i) {
-          trg_x[pverp - i - 1] = m2km * p_tgt_c(icol, i);
-        }
-        team.team_barrier();
-        mam4::vertical_interpolation::rebin(team, levsiz, nlevs_tgt,
-                                            src_x, trg_x, datain_at_icol, dataout_at_icol);
-      });
+void VerticalRemapperMAM4::
+apply_elevated_emissions_rebin (const int first, const int count) const
+{
+  Kokkos::Array<view_2d<Real>,max_batched_fields> datain;
+  Kokkos::Array<view_2d<Real>,max_batched_fields> dataout;
+  for (int n=0; n<count; ++n) {
+    datain[n]  = m_src_fields[first+n].get_view<Real **>();
+    dataout[n] = m_tgt_fields[first+n].get_view<Real **>();
   }
 
+  const auto src_x   = m_src_pmid.get_view<const Real *>();
+  const auto p_tgt_c = m_tgt_pmid.get_view<const Real **>();
+
+  const int ncols     = m_src_grid->get_num_local_dofs();
+  // All sectors are on the same src/tgt vertical layouts
+  const int nlevs_tgt = m_tgt_fields[first].get_header().get_identifier().get_layout().dims().back();
+  const int levsiz    = m_src_fields[first].get_header().get_identifier().get_layout().dims().back();
+  const int pverp     = nlevs_tgt+1;
+  //FIXME: get this values from grid.
+  constexpr int nlev = mam4::nlev;
+  constexpr Real m2km    = 1e-3;
+
+  using TPF = ekat::TeamPolicyFactory<KT::ExeSpace>;
+  const auto policy = TPF::get_default_team_policy(ncols, nlevs_tgt);
+  using Team = Kokkos::TeamPolicy<KT::ExeSpace>::member_type;
+  Kokkos::parallel_for(
+  "vert_interpolation_elevated_emissions_batched", policy,
+  KOKKOS_LAMBDA(const Team &team) {
+    const int icol = team.league_rank();
+
+    // model_z(1:pverp) = m2km * state(c)%zi(i,pverp:1:-1)
+    Real trg_x[nlev + 1];
+    for(int i = 0; i < pverp; ++i) {
+      trg_x[pverp - i - 1] = m2km * p_tgt_c(icol, i);
+    }
+    team.team_barrier();
+    for (int n=0; n<count; ++n) {
+      const auto datain_at_icol  = ekat::subview(datain[n], icol);
+      const auto dataout_at_icol = ekat::subview(dataout[n], icol);
+      mam4::vertical_interpolation::rebin(team, levsiz, nlevs_tgt,
+                                          src_x, trg_x, datain_at_icol, dataout_at_icol);
+      team.team_barrier();
+    }
+  });
 }
 
 } // namespace scream
@@ -42,10 +42,17 @@ protected:
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
+  // PSRef and zonal remaps (elevated emissions use apply_elevated_emissions_rebin)
   void apply_vertical_interpolation (const Field& f_src, const Field& f_tgt,
                                      const Field& p_src, const Field& p_tgt) const;
+  // Remaps fields [first,first+count) in a single kernel, building the
+  // target altitude profile only once per column
+  void apply_elevated_emissions_rebin (const int first, const int count) const;
 
 protected:
+  // Max number of fields remapped by a single elevated emissions kernel
+  static constexpr int max_batched_fields = 8;
+
   VertRemapType         m_vremap_type;
 };
 
@@ -7,6 +7,7 @@
 
 #include <ekat_lin_interp.hpp>
 #include <ekat_math_utils.hpp>
+#include <ekat_string_utils.hpp>
 #include <ekat_team_policy_utils.hpp>
 
 namespace scream
@@ -20,6 +21,9 @@ Nudging::Nudging (const ekat::Comm& comm, const ekat::ParameterList& params)
   m_timescale = m_params.get<int>("nudging_timescale",0);
 
   m_fields_nudge = m_params.get<std::vector<std::string>>("nudging_fields");
+  EKAT_REQUIRE_MSG (m_fields_nudge.size()<=max_nudged_fields,
+      "Error! Nudging supports at most " << max_nudged_fields << " nudged fields.\n"
+      " - nudging_fields: " << ekat::join(m_fields_nudge,",") << "\n");
   m_use_weights   = m_params.get<bool>("use_nudging_weights",false);
   m_skip_vert_interpolation   = m_params.get<bool>("skip_vert_interpolation",false);
   // If we are doing horizontal refine-remapping, we need to get the mapfile from user
@@ -164,17 +168,24 @@ void Nudging::create_requests()
   }
 }
 // =========================================================================================
-void Nudging::apply_tendency(Field& state, const Field& nudge, const Real dt) const
+void Nudging::apply_tendencies(const std::string& nudge_suffix, const Real dt)
 {
   // Calculate the weight to apply the tendency
   const Real dtend = dt / m_timescale;
 
-  using cview_2d = decltype(state.get_view<const Real**>());
+  using view_2d  = Field::get_view_type<Real**,Device>;
+  using cview_2d = Field::get_view_type<const Real**,Device>;
 
-  auto state_view = state.get_view<Real**>();
-  auto nudge_view = nudge.get_view<Real**>();
-  cview_2d w_view, pmid_view;
+  const int nfields = m_fields_nudge.size();
+  Kokkos::Array<view_2d,max_nudged_fields>  state_views;
+  Kokkos::Array<cview_2d,max_nudged_fields> nudge_views;
+  for (int ifld=0; ifld<nfields; ++ifld) {
+    const auto& name = m_fields_nudge[ifld];
+    state_views[ifld] = get_field_out_wrap(name).get_view<Real**>();
+    nudge_views[ifld] = get_helper_field(name+nudge_suffix).get_view<const Real**>();
+  }
 
+  cview_2d w_view, pmid_view;
   if (m_use_weights) {
     auto weights = get_helper_field("nudging_weights");
     w_view = weights.get_view<const Real**>();
@@ -185,17 +196,17 @@ void Nudging::apply_tendency(Field& state, const Field& nudge, const Real dt) co
 
   auto use_weights = m_use_weights;
   auto cutoff = m_refine_remap_vert_cutoff;
-  auto policy = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {m_num_cols, m_num_levs});
-  auto update = KOKKOS_LAMBDA(const int& i, const int& j) {
+  auto policy = Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {nfields, m_num_cols, m_num_levs});
+  auto update = KOKKOS_LAMBDA(const int& ifld, const int& i, const int& j) {
     if (cutoff>0 and pmid_view(i,j)>=cutoff) {
       return;
     }
 
-    auto tend = nudge_view(i,j) - state_view(i,j);
+    auto tend = nudge_views[ifld](i,j) - state_views[ifld](i,j);
     if (use_weights) {
       tend *= w_view(i,j);
     }
-    state_view(i,j) += dtend * tend;
+    state_views[ifld](i,j) += dtend * tend;
   };
   Kokkos::parallel_for(policy,update);
 }
@@ -270,10 +281,15 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     }
   }
 
-  // A helper field, where we copy each field after horiz remap, padding it
-  // at top/bot, to allow vert lin interp to extrapolate outside the bounds of p_mid
+  // Helper fields, where we copy each field after horiz remap, padding it
+  // at top/bot, to allow vert lin interp to extrapolate outside the bounds of p_mid.
+  // Each field gets its own, so that all fields can be interpolated in one kernel.
   FieldLayout layout_padded ({COL,LEV},{m_num_cols,m_num_src_levs+2});
-  create_helper_field("padded_field",layout_padded,"");
+  if (not m_skip_vert_interpolation) {
+    for (const auto& name : m_fields_nudge) {
+      create_helper_field("padded_"+name,layout_padded,"");
+    }
+  }
 
   if (m_src_pres_type == TIME_DEPENDENT_3D_PROFILE && !m_skip_vert_interpolation) {
     // If the pressure profile is 3d and time-dep, we need to interpolate (in time/horiz)
@@ -319,17 +335,37 @@ void Nudging::initialize_impl (const RunType /* run_type */)
 // =========================================================================================
 void Nudging::run_impl (const double dt)
 {
-  using KT            = KokkosTypes<DefaultDevice>;
-  using RangePolicy   = typename KT::RangePolicy;
-  using MemberType    = typename KT::MemberType;
-  using TPF           = ekat::TeamPolicyFactory<typename KT::ExeSpace>;
-  using PackT         = ekat::Pack<Real,1>;
-  using view_1d       = KT::view_1d<PackT>;
-  using view_2d       = KT::view_2d<PackT>;
-
   // Perform time interpolation
   m_time_interp.perform_time_interpolation(end_of_step_ts());
 
+  // Cure masked values before horiz remap
+  fix_masked_values();
+
+  // Perform horizontal remap (if needed). The remapper handles all
+  // registered fields at once, with a single halo exchange.
+  m_horiz_remapper->remap_fwd();
+
+  // bypass copy_and_pad and vert_interp for skip_vert_interpolation:
+  if (m_skip_vert_interpolation) {
+    if (m_timescale > 0) {
+      apply_tendencies("_tmp",dt);
+    }
+    return;
+  }
+
+  vert_interp_and_relax(dt);
+}
+
+// =========================================================================================
+void Nudging::fix_masked_values ()
+{
+  using KT          = KokkosTypes<DefaultDevice>;
+  using MemberType  = typename KT::MemberType;
+  using TPF         = ekat::TeamPolicyFactory<typename KT::ExeSpace>;
+  using view_2d     = Field::get_view_type<Real**,Device>;
+  using minmax_t    = Kokkos::MinMax<int>;
+  using minmax_val  = typename minmax_t::value_type;
+
   // If the input data contains "masked" values (sometimes also called "filled" values),
   // the horiz remapping would smear them around. To prevent that, we need to "cure"
   // these values. Masked values can only happen at top/bot of the model (with top
@@ -340,73 +376,82 @@ void Nudging::run_impl (const double dt)
   //       even if both f(t_beg)/f(t_end) are equal to fillValue (due to rounding).
   // NOTE: if f(t_beg)==fillValue!=f(t_end), or viceversa, the time-interpolated value can
   //       substantially differ from fillValue. Here, we assume it didn't happen.
-  auto correct_masked_values = [&](const Field f) {
-    const auto fl = f.get_header().get_identifier().get_layout();
-    const auto v  = f.get_view<Real**>();
-
-    constexpr Real fill_value = constants::fill_value<Real>;
-
-    const int ncols = fl.dim(0);
-    const int nlevs = fl.dim(1);
-    const auto thresh = std::abs(fill_value)*0.0001;
-    auto lambda = KOKKOS_LAMBDA(const int icol) {
-      int first_good = nlevs;
-      int last_good = -1;
-      for (int k=0; k<nlevs; ++k) {
-        if (std::abs(v(icol,k)-fill_value)>thresh) {
-          // This entry is substantially different from fill_value, so it's good
-          first_good = ekat::impl::min(first_good,k);
-          last_good  = ekat::impl::max(last_good,k);
-        }
-      }
-      EKAT_KERNEL_REQUIRE_MSG (first_good<nlevs and last_good>=0,
-          "[Nudging] Error! Could not locate a non-masked entry in a column.\n");
+  const int nfields = m_fields_nudge.size();
+  Kokkos::Array<view_2d,max_nudged_fields> views;
+  for (int ifld=0; ifld<nfields; ++ifld) {
+    views[ifld] = get_helper_field(m_fields_nudge[ifld]+"_ext").get_view<Real**>();
+  }
+  if (nfields==0) {
+    return;
+  }
 
-      // Fix near TOM
-      for (int k=0; k<first_good; ++k) {
-        v(icol,k) = v(icol,first_good);
+  const auto fl = get_helper_field(m_fields_nudge[0]+"_ext").get_header().get_identifier().get_layout();
+  const int ncols = fl.dim(0);
+  const int nlevs = fl.dim(1);
+
+  constexpr Real fill_value = constants::fill_value<Real>;
+  const auto thresh = std::abs(fill_value)*0.0001;
+
+  // One team per (field,column): locate the first/last good entries with a
+  // team reduction, then overwrite the masked entries in parallel
+  auto lambda = KOKKOS_LAMBDA(const MemberType& team) {
+    const int ifld = team.league_rank() / ncols;
+    const int icol = team.league_rank() % ncols;
+    const auto& v = views[ifld];
+
+    minmax_val good;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team,nlevs),
+                            [&](const int k, minmax_val& mm) {
+      if (std::abs(v(icol,k)-fill_value)>thresh) {
+        // This entry is substantially different from fill_value, so it's good
+        mm.min_val = ekat::impl::min(mm.min_val,k);
+        mm.max_val = ekat::impl::max(mm.max_val,k);
       }
-      // Fix near surf
-      for (int k=last_good+1; k<nlevs; ++k) {
+    },minmax_t(good));
+    const int first_good = good.min_val;
+    const int last_good  = good.max_val;
+    EKAT_KERNEL_REQUIRE_MSG (first_good<nlevs and last_good>=0,
+        "[Nudging] Error! Could not locate a non-masked entry in a column.\n");
+
+    // Fix near TOM and near surf. Only masked entries are written, and only
+    // good entries are read, so there is no race between threads.
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs),[&](const int k) {
+      if (k<first_good) {
+        v(icol,k) = v(icol,first_good);
+      } else if (k>last_good) {
         v(icol,k) = v(icol,last_good);
       }
-    };
-
-    Kokkos::parallel_for(RangePolicy(0,ncols),lambda);
+    });
   };
 
-  // Correct before horiz remap
-  for (const auto& name: m_fields_nudge) {
-    const auto f  = get_helper_field(name+"_ext");
-    correct_masked_values(f);
-  }
-
-  // Perform horizontal remap (if needed)
-  m_horiz_remapper->remap_fwd();
-
-  // bypass copy_and_pad and vert_interp for skip_vert_interpolation:
-  if (m_skip_vert_interpolation) {
-    for (const auto& name : m_fields_nudge) {
-      auto tmp_state_field = get_helper_field(name+"_tmp");
+  const auto policy = TPF::get_default_team_policy(nfields*ncols,nlevs);
+  Kokkos::parallel_for("nudging_fix_masked_values", policy, lambda);
+}
 
-      if (m_timescale > 0) {
-        auto atm_state_field = get_field_out_wrap(name);
-        apply_tendency(atm_state_field,tmp_state_field,dt);
-      }
-    }
-    return;
-  }
+// =========================================================================================
+void Nudging::vert_interp_and_relax (const Real dt)
+{
+  using KT            = KokkosTypes<DefaultDevice>;
+  using RangePolicy   = typename KT::RangePolicy;
+  using MemberType    = typename KT::MemberType;
+  using TPF           = ekat::TeamPolicyFactory<typename KT::ExeSpace>;
+  using PackT         = ekat::Pack<Real,1>;
+  using view_1d       = KT::view_1d<PackT>;
+  using view_2d       = KT::view_2d<PackT>;
+  using cview_2d      = KT::view_2d<const PackT>;
+  using rview_2d      = Field::get_view_type<Real**,Device>;
+  using crview_2d     = Field::get_view_type<const Real**,Device>;
 
   // Copy remapper tgt fields into padded views, to allow extrapolation at top/bot,
   // then call remapping routines
 
   const int ncols = m_num_cols;
   const int nlevs_src = m_num_src_levs;
-  auto copy_and_pad = [&](const Field from, const Field to, const bool is_pmid) {
-    auto from_view = from.get_view<const Real**>();
-    auto to_view = to.get_view<Real**>();
-    auto fl = from.get_header().get_identifier().get_layout();
 
+  // First, copy/pad p_mid, and extract the right copy (1d vs 3d)
+  if (m_src_pres_type==TIME_DEPENDENT_3D_PROFILE) {
+    auto from_view = get_helper_field("p_mid_tmp").get_view<const Real**>();
+    auto to_view   = get_helper_field("padded_p_mid_tmp").get_view<Real**>();
     auto copy_3d = KOKKOS_LAMBDA (const MemberType& team) {
       int icol = team.league_rank();
 
@@ -415,31 +460,17 @@ void Nudging::run_impl (const double dt)
       };
       Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_src),copy_col);
 
-      // Set the first/last entries of data, so that linear interp
-      // can extrapolate if the p_tgt is outside the p_src bounds
+      // Set the first/last entries, so that linear interp can extrapolate
+      // if the p_tgt is outside the p_src bounds. For pmid, we put a very
+      // large value at the bottom, so that any p_mid_tgt that is larger
+      // than input p_mid bnds will end up in the last interval.
       Kokkos::single(Kokkos::PerTeam(team),[&]{
-        to_view(icol,0) = 0; // Does this make sense for *every field*?
-        if (is_pmid) {
-          // For pmid, we put a very large value, so that any p_mid_tgt
-          // that is larger than input p_mid bnds will end up in the
-          // last interval.
-          to_view(icol,nlevs_src+1) = 1e7;
-        } else {
-          // For data, we set last entry equal to second-to-last.
-          // This will cause constant extrapolation outside of
-          // the input p_mid bounds
-          to_view(icol,nlevs_src+1) = from_view(icol,nlevs_src-1);
-        }
+        to_view(icol,0) = 0;
+        to_view(icol,nlevs_src+1) = 1e7;
       });
     };
-
     auto policy = TPF::get_default_team_policy(ncols,nlevs_src);
-    Kokkos::parallel_for("", policy, copy_3d);
-  };
-
-  // First, copy/pad p_mid, and extract the right copy (1d vs 3d)
-  if (m_src_pres_type==TIME_DEPENDENT_3D_PROFILE) {
-    copy_and_pad (get_helper_field("p_mid_tmp"),get_helper_field("padded_p_mid_tmp"),true);
+    Kokkos::parallel_for("nudging_pad_p_mid", policy, copy_3d);
   } else {
     // pmid is a 1d view. Just pad by hand
     auto from = get_helper_field("p_mid_tmp");
@@ -456,7 +487,6 @@ void Nudging::run_impl (const double dt)
     };
     Kokkos::parallel_for(RangePolicy(0,nlevs_src),lambda);
   }
-  const auto& p_mid_v = get_field_in("p_mid").get_view<const PackT**>();
   view_2d p_mid_tmp_3d;
   view_1d p_mid_tmp_1d;
   bool src_pmid_3d;
@@ -472,9 +502,9 @@ void Nudging::run_impl (const double dt)
   using LI = ekat::LinInterp<Real,1>;
   const int nlevs_tgt = m_num_levs;
   LI vert_interp(ncols,nlevs_src+2,nlevs_tgt);
-  const auto policy_vinterp = TPF::get_default_team_policy(ncols, nlevs_tgt);
+  const auto policy_setup = TPF::get_default_team_policy(ncols, nlevs_tgt);
   auto p_tgt = get_field_in("p_mid").get_view<const PackT**>();
-  Kokkos::parallel_for("nudging_vert_interp_setup_loop", policy_vinterp,
+  Kokkos::parallel_for("nudging_vert_interp_setup_loop", policy_setup,
     KOKKOS_LAMBDA(const MemberType& team) {
 
     const int icol = team.league_rank();
@@ -490,42 +520,94 @@ void Nudging::run_impl (const double dt)
   });
   Kokkos::fence();
 
-  // Then loop over fields, and do copy_and_pad + vremap
-  auto padded_field = get_helper_field("padded_field");
-  for (const auto& name : m_fields_nudge) {
-    copy_and_pad(get_helper_field(name+"_tmp"),padded_field,false);
-
-    auto field_after_vinterp = get_helper_field(name);
-    auto view_in  = padded_field.get_view<const PackT**>();
-    auto view_out = field_after_vinterp.get_view<PackT**>();
-    // Now use the interpolation object in || over all variables.
-    auto vinterp = KOKKOS_LAMBDA(const MemberType& team) {
-      const int icol = team.league_rank();
-
-      view_1d x1;
-      if (src_pmid_3d) {
-        x1 = ekat::subview(p_mid_tmp_3d,icol);
-      } else {
-        x1 = p_mid_tmp_1d;
-      }
-      auto x2 = ekat::subview(p_tgt,icol);
+  // Gather the views of all nudged fields. If timescale==0, the helper field
+  // "name" is an alias of get_field_out_wrap(name), so vinterp writes
+  // directly in the atm state. If timescale>0, we back out a tendency.
+  const int nfields = m_fields_nudge.size();
+  Kokkos::Array<crview_2d,max_nudged_fields> tmp_views;
+  Kokkos::Array<rview_2d,max_nudged_fields>  padded_views;
+  Kokkos::Array<cview_2d,max_nudged_fields>  padded_pack_views;
+  Kokkos::Array<view_2d,max_nudged_fields>   vinterp_pack_views;
+  Kokkos::Array<rview_2d,max_nudged_fields>  vinterp_views;
+  Kokkos::Array<rview_2d,max_nudged_fields>  state_views;
+  for (int ifld=0; ifld<nfields; ++ifld) {
+    const auto& name = m_fields_nudge[ifld];
+    tmp_views[ifld]     = get_helper_field(name+"_tmp").get_view<const Real**>();
+    padded_views[ifld]  = get_helper_field("padded_"+name).get_view<Real**>();
+    vinterp_views[ifld] = get_helper_field(name).get_view<Real**>();
+    padded_pack_views[ifld]  = get_helper_field("padded_"+name).get_view<const PackT**>();
+    vinterp_pack_views[ifld] = get_helper_field(name).get_view<PackT**>();
+    if (m_timescale > 0) {
+      state_views[ifld] = get_field_out_wrap(name).get_view<Real**>();
+    }
+  }
 
-      auto y1 = ekat::subview(view_in, icol);
-      auto y2 = ekat::subview(view_out,icol);
+  const bool relax = m_timescale > 0;
+  const Real dtend = relax ? dt / m_timescale : 0;
+  const bool use_weights = m_use_weights;
+  const Real cutoff = m_refine_remap_vert_cutoff;
+  crview_2d w_view, pmid_view;
+  if (relax and use_weights) {
+    w_view = get_helper_field("nudging_weights").get_view<const Real**>();
+  }
+  if (relax and cutoff>0) {
+    pmid_view = get_field_in("p_mid").get_view<const Real**>();
+  }
 
-      vert_interp.lin_interp(team, x1, x2, y1, y2, icol);
-    };
-    Kokkos::parallel_for("nudging_vert_interp_loop", policy_vinterp, vinterp);
-    Kokkos::fence();
+  // One team per (field,column): pad the column, interpolate it to the
+  // atm pressure levels, and relax the atm state towards it
+  auto vinterp = KOKKOS_LAMBDA(const MemberType& team) {
+    const int ifld = team.league_rank() / ncols;
+    const int icol = team.league_rank() % ncols;
+
+    const auto& from   = tmp_views[ifld];
+    const auto& padded = padded_views[ifld];
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_src),[&](const int k) {
+      padded(icol,k+1) = from(icol,k);
+    });
+    // For data, we set the first entry to 0 and the last entry equal to
+    // second-to-last. This causes constant extrapolation below the input p_mid
+    // bounds. Does the top value make sense for *every field*?
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      padded(icol,0) = 0;
+      padded(icol,nlevs_src+1) = from(icol,nlevs_src-1);
+    });
+    team.team_barrier();
+
+    view_1d x1;
+    if (src_pmid_3d) {
+      x1 = ekat::subview(p_mid_tmp_3d,icol);
+    } else {
+      x1 = p_mid_tmp_1d;
+    }
+    auto x2 = ekat::subview(p_tgt,icol);
 
-    // If timescale==0, the call get_helper_field(name) returns the same
-    // fields as get_field_out_wrap(name) they are alias, so nothing to do.
-    // If timescale>0, then we need to back out a tendency.
-    if (m_timescale > 0) {
-      auto atm_state_field = get_field_out_wrap(name);
-      apply_tendency(atm_state_field,field_after_vinterp,dt);
+    auto y1 = ekat::subview(padded_pack_views[ifld], icol);
+    auto y2 = ekat::subview(vinterp_pack_views[ifld],icol);
+
+    vert_interp.lin_interp(team, x1, x2, y1, y2, icol);
+
+    if (not relax) {
+      return;
     }
-  }
+    team.team_barrier();
+
+    const auto& nudge = vinterp_views[ifld];
+    const auto& state = state_views[ifld];
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt),[&](const int k) {
+      if (cutoff>0 and pmid_view(icol,k)>=cutoff) {
+        return;
+      }
+
+      auto tend = nudge(icol,k) - state(icol,k);
+      if (use_weights) {
+        tend *= w_view(icol,k);
+      }
+      state(icol,k) += dtend * tend;
+    });
+  };
+  const auto policy_vinterp = TPF::get_default_team_policy(nfields*ncols, nlevs_tgt);
+  Kokkos::parallel_for("nudging_vert_interp_loop", policy_vinterp, vinterp);
 }
 
 // =========================================================================================
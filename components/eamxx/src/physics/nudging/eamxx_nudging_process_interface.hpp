@@ -45,9 +45,14 @@ protected:
 
   void run_impl (const double dt) override;
 
-  // Internal function to apply nudging at specific timescale
+  // Internal function to apply nudging at specific timescale to all nudged fields,
+  // using the helper fields name+nudge_suffix as nudging targets
   // NOTE: this method will handle weighted and cutoff cases as well
-  void apply_tendency (Field &state, const Field &nudge, const Real dt) const;
+  void apply_tendencies (const std::string& nudge_suffix, const Real dt);
+
+  // Batched steps of run_impl, each a single kernel over all nudged fields
+  void fix_masked_values ();
+  void vert_interp_and_relax (const Real dt);
 
 protected:
 
@@ -85,6 +90,10 @@ protected:
 
   std::vector<std::string> m_fields_nudge;
 
+  // Nudged fields are processed in batched kernels, which capture their views
+  // in fixed-size arrays. Only T_mid, qv, U and V can currently be nudged.
+  static constexpr int max_nudged_fields = 4;
+
   /* Nudge from coarse data */
   // if true, remap coarse data to fine grid
   bool m_refine_remap;
@@ -0,0 +1,192 @@
+#ifndef P3_ICE_TABLES_CACHE_HPP
+#define P3_ICE_TABLES_CACHE_HPP
+
+#include <ekat_assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Reading of the P3 ice lookup tables into host views, from the text table
+ * or from its binary cache. These are host-only utilities, kept out of
+ * p3_init_impl.hpp so that they can be unit tested.
+ */
+
+namespace scream {
+namespace p3 {
+
+// Binary cache of the ice lookup tables, written by p3_tables_setup. The header is
+// followed by the ice table and by the (log10 of the) collection table, as doubles,
+// in the layout of the host views. If the cache is missing or does not match
+// the expected version/sizes/checksum, we fall back to parsing the text table.
+struct IceTablesBinHeader {
+  char          magic[8];
+  std::int32_t  format_version;
+  std::int32_t  scalar_size; // sizeof(Scalar) of the build that parsed the text table
+  char          p3_version[16];
+  std::int32_t  dims[6]; // densize, rimsize, isize, ice_table_size, rcollsize, collect_table_size
+  std::uint64_t checksum;
+};
+
+constexpr const char* ice_tables_bin_magic = "P3ICETB";
+constexpr std::int32_t ice_tables_bin_format_version = 1;
+
+inline std::uint64_t fnv1a_checksum (const std::vector<double>& data)
+{
+  std::uint64_t h = 14695981039346656037ull;
+  const auto bytes = reinterpret_cast<const unsigned char*>(data.data());
+  for (size_t i=0; i<data.size()*sizeof(double); ++i) {
+    h ^= bytes[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+inline IceTablesBinHeader make_ice_tables_bin_header (const char* p3_version, const int scalar_size, const std::vector<int>& dims)
+{
+  IceTablesBinHeader header;
+  std::memset(&header,0,sizeof(header));
+  std::strncpy(header.magic,ice_tables_bin_magic,sizeof(header.magic)-1);
+  std::strncpy(header.p3_version,p3_version,sizeof(header.p3_version)-1);
+  header.format_version = ice_tables_bin_format_version;
+  header.scalar_size = scalar_size;
+  for (int i=0; i<6; ++i) {
+    header.dims[i] = dims[i];
+  }
+  return header;
+}
+
+template <typename IceH, typename CollH>
+std::vector<int> get_ice_tables_dims (const IceH& ice_h, const CollH& coll_h)
+{
+  return {static_cast<int>(ice_h.extent(0)), static_cast<int>(ice_h.extent(1)),
+          static_cast<int>(ice_h.extent(2)), static_cast<int>(ice_h.extent(3)),
+          static_cast<int>(coll_h.extent(3)),static_cast<int>(coll_h.extent(4))};
+}
+
+template <typename IceH, typename CollH>
+bool read_ice_lookup_tables_bin (const std::string& filename, const char* p3_version, IceH& ice_h, CollH& coll_h)
+{
+  std::ifstream in(filename, std::ios::binary);
+  if (not in.good()) {
+    return false;
+  }
+
+  IceTablesBinHeader header, expected = make_ice_tables_bin_header(p3_version,sizeof(typename IceH::value_type),get_ice_tables_dims(ice_h,coll_h));
+  in.read(reinterpret_cast<char*>(&header),sizeof(header));
+  if (not in.good() or
+      std::memcmp(header.magic,expected.magic,sizeof(header.magic))!=0 or
+      header.format_version!=expected.format_version or
+      header.scalar_size!=expected.scalar_size or
+      std::memcmp(header.p3_version,expected.p3_version,sizeof(header.p3_version))!=0 or
+      std::memcmp(header.dims,expected.dims,sizeof(header.dims))!=0) {
+    return false;
+  }
+
+  std::vector<double> data(ice_h.size()+coll_h.size());
+  in.read(reinterpret_cast<char*>(data.data()),sizeof(double)*data.size());
+  if (not in.good() or fnv1a_checksum(data)!=header.checksum) {
+    return false;
+  }
+
+  std::copy_n(data.begin(),ice_h.size(),ice_h.data());
+  std::copy_n(data.begin()+ice_h.size(),coll_h.size(),coll_h.data());
+  return true;
+}
+
+template <typename IceH, typename CollH>
+void write_ice_lookup_tables_bin (const std::string& filename, const char* p3_version, const IceH& ice_h, const CollH& coll_h)
+{
+  std::vector<double> data(ice_h.data(),ice_h.data()+ice_h.size());
+  data.insert(data.end(),coll_h.data(),coll_h.data()+coll_h.size());
+
+  auto header = make_ice_tables_bin_header(p3_version,sizeof(typename IceH::value_type),get_ice_tables_dims(ice_h,coll_h));
+  header.checksum = fnv1a_checksum(data);
+
+  std::ofstream out(filename, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+  out.write(reinterpret_cast<const char*>(data.data()),sizeof(double)*data.size());
+  EKAT_REQUIRE_MSG(out.good(), "Error! Could not write P3 ice lookup tables cache " << filename);
+}
+
+template <typename IceH, typename CollH>
+void parse_ice_lookup_tables_text (const std::string& filename, const char* p3_version, IceH& ice_table_vals_h, CollH& collect_table_vals_h, int densize, int rimsize, int isize, int rcollsize)
+{
+  std::ifstream in(filename);
+
+  // read header
+  std::string version, version_val;
+  in >> version >> version_val;
+  EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
+  EKAT_REQUIRE_MSG(version_val == p3_version, "Bad " << filename << ", expected version " << p3_version << ", but got " << version_val);
+
+  // read tables
+  double dum_s; int dum_i; // dum_s needs to be double to stream correctly
+  for (int jj = 0; jj < densize; ++jj) {
+    for (int ii = 0; ii < rimsize; ++ii) {
+      for (int i = 0; i < isize; ++i) {
+        in >> dum_i >> dum_i;
+        int j_idx = 0;
+        for (int j = 0; j < 15; ++j) {
+          in >> dum_s;
+          if (j > 1 && j != 10) {
+            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+          }
+        }
+      }
+
+      for (int i = 0; i < isize; ++i) {
+        for (int j = 0; j < rcollsize; ++j) {
+          in >> dum_i >> dum_i;
+          int k_idx = 0;
+          for (int k = 0; k < 6; ++k) {
+            in >> dum_s;
+            if (k == 3 || k == 4) {
+              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// Fill the host views from the binary cache bin_filename if it is valid, and
+// from the text table filename otherwise. If write_bin_cache=true, the text
+// table is always parsed, and the binary cache is (re)generated.
+// Returns true if the tables were read from the binary cache.
+template <typename IceH, typename CollH>
+bool load_ice_lookup_tables (const bool masterproc, const std::string& filename, const std::string& bin_filename,
+                             const char* p3_version, IceH& ice_table_vals_h, CollH& collect_table_vals_h,
+                             int densize, int rimsize, int isize, int rcollsize, const bool write_bin_cache)
+{
+  if (not write_bin_cache and read_ice_lookup_tables_bin(bin_filename, p3_version, ice_table_vals_h, collect_table_vals_h)) {
+    if (masterproc) {
+      std::cout << "Reading ice lookup tables in file: " << bin_filename << std::endl;
+    }
+    return true;
+  }
+
+  if (masterproc) {
+    std::cout << "Reading ice lookup tables in file: " << filename << std::endl;
+  }
+  parse_ice_lookup_tables_text(filename, p3_version, ice_table_vals_h, collect_table_vals_h, densize, rimsize, isize, rcollsize);
+  if (write_bin_cache) {
+    if (masterproc) {
+      std::cout << "Writing ice lookup tables cache in file: " << bin_filename << std::endl;
+    }
+    write_ice_lookup_tables_bin(bin_filename, p3_version, ice_table_vals_h, collect_table_vals_h);
+  }
+  return false;
+}
+
+} // namespace p3
+} // namespace scream
+
+#endif // P3_ICE_TABLES_CACHE_HPP
@@ -2,6 +2,9 @@
 #define P3_INIT_IMPL_HPP
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
+#include "p3_ice_tables_cache.hpp"
+
+#include <ekat_comm.hpp>
 
 #include <fstream>
 
@@ -10,8 +13,11 @@ namespace p3 {
 
 namespace {
 
+// If comm is not null, only its root rank reads the tables, and broadcasts them to the others.
+// If write_bin_cache=true, the text table is always parsed, and the binary cache is (re)generated.
 template <typename S, typename IceT, typename CollT>
-void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, const char* p3_version, IceT& ice_table_vals, CollT& collect_table_vals, int densize, int rimsize, int isize, int rcollsize)
+void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, const char* p3_version, IceT& ice_table_vals, CollT& collect_table_vals, int densize, int rimsize, int isize, int rcollsize,
+                            const ekat::Comm* comm = nullptr, const bool write_bin_cache = false)
 {
   using DeviceIcetable = typename IceT::non_const_type;
   using DeviceColtable = typename CollT::non_const_type;
@@ -27,47 +33,16 @@ void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, c
   //
 
   std::string filename = std::string(p3_lookup_base) + std::string(p3_version);
+  std::string bin_filename = filename + ".bin";
 
-  if (masterproc) {
-    std::cout << "Reading ice lookup tables in file: " << filename << std::endl;
+  if (comm==nullptr or comm->am_i_root()) {
+    load_ice_lookup_tables(masterproc, filename, bin_filename, p3_version, ice_table_vals_h, collect_table_vals_h,
+                           densize, rimsize, isize, rcollsize, write_bin_cache);
   }
 
-  std::ifstream in(filename);
-
-  // read header
-  std::string version, version_val;
-  in >> version >> version_val;
-  EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
-  EKAT_REQUIRE_MSG(version_val == p3_version, "Bad " << filename << ", expected version " << p3_version << ", but got " << version_val);
-
-  // read tables
-  double dum_s; int dum_i; // dum_s needs to be double to stream correctly
-  for (int jj = 0; jj < densize; ++jj) {
-    for (int ii = 0; ii < rimsize; ++ii) {
-      for (int i = 0; i < isize; ++i) {
-        in >> dum_i >> dum_i;
-        int j_idx = 0;
-        for (int j = 0; j < 15; ++j) {
-          in >> dum_s;
-          if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
-          }
-        }
-      }
-
-      for (int i = 0; i < isize; ++i) {
-        for (int j = 0; j < rcollsize; ++j) {
-          in >> dum_i >> dum_i;
-          int k_idx = 0;
-          for (int k = 0; k < 6; ++k) {
-            in >> dum_s;
-            if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
-            }
-          }
-        }
-      }
-    }
+  if (comm!=nullptr) {
+    comm->broadcast(ice_table_vals_h.data(), ice_table_vals_h.size(), comm->root_rank());
+    comm->broadcast(collect_table_vals_h.data(), collect_table_vals_h.size(), comm->root_rank());
   }
 
   // deep copy to device
@@ -210,8 +185,10 @@ static void action(StreamT& stream, S* data, const size_t size)
   }
 }
 
+// If comm is not null, only its root rank reads the files, and broadcasts the tables to the others
 template <bool IsRead, typename MuRT, typename VNT, typename VMT, typename RevapT>
-void io_impl(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT& vn_table_vals, VMT& vm_table_vals, RevapT& revap_table_vals)
+void io_impl(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT& vn_table_vals, VMT& vm_table_vals, RevapT& revap_table_vals,
+             const ekat::Comm* comm = nullptr)
 {
   if (masterproc) {
     std::cout << (IsRead ? "Reading" : "Writing") << " lookup (non-ice) tables in dir " << dir << std::endl;
@@ -240,19 +217,27 @@ void io_impl(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT&
 
   using stream_t = std::conditional_t<IsRead,std::ifstream,std::ofstream>;
 
-  stream_t mu_r_file(mu_r_filename.c_str(), std::ios::binary);
-  stream_t revap_file(revap_filename.c_str(), std::ios::binary);
-  stream_t vn_file(vn_filename.c_str(), std::ios::binary);
-  stream_t vm_file(vm_filename, std::ios::binary);
-
-  // Read files
-  action(mu_r_file, mu_r_table_vals_h.data(), mu_r_table_vals.size());
-  action(revap_file, revap_table_vals_h.data(), revap_table_vals.size());
-  action(vn_file, vn_table_vals_h.data(), vn_table_vals.size());
-  action(vm_file, vm_table_vals_h.data(), vm_table_vals.size());
+  if (comm==nullptr or comm->am_i_root()) {
+    stream_t mu_r_file(mu_r_filename.c_str(), std::ios::binary);
+    stream_t revap_file(revap_filename.c_str(), std::ios::binary);
+    stream_t vn_file(vn_filename.c_str(), std::ios::binary);
+    stream_t vm_file(vm_filename, std::ios::binary);
+
+    // Read files
+    action(mu_r_file, mu_r_table_vals_h.data(), mu_r_table_vals.size());
+    action(revap_file, revap_table_vals_h.data(), revap_table_vals.size());
+    action(vn_file, vn_table_vals_h.data(), vn_table_vals.size());
+    action(vm_file, vm_table_vals_h.data(), vm_table_vals.size());
+  }
 
   // Copy back to device
   if constexpr (IsRead) {
+    if (comm!=nullptr) {
+      comm->broadcast(mu_r_table_vals_h.data(), mu_r_table_vals_h.size(), comm->root_rank());
+      comm->broadcast(revap_table_vals_h.data(), revap_table_vals_h.size(), comm->root_rank());
+      comm->broadcast(vn_table_vals_h.data(), vn_table_vals_h.size(), comm->root_rank());
+      comm->broadcast(vm_table_vals_h.data(), vm_table_vals_h.size(), comm->root_rank());
+    }
     Kokkos::deep_copy(mu_r_table_vals, mu_r_table_vals_h);
     Kokkos::deep_copy(revap_table_vals, revap_table_vals_h);
     Kokkos::deep_copy(vn_table_vals, vn_table_vals_h);
@@ -261,7 +246,8 @@ void io_impl(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT&
 }
 
 template <typename MuRT, typename VNT, typename VMT, typename RevapT>
-void read_computed_tables(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT& vn_table_vals, VMT& vm_table_vals, RevapT& revap_table_vals)
+void read_computed_tables(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT& vn_table_vals, VMT& vm_table_vals, RevapT& revap_table_vals,
+                          const ekat::Comm* comm = nullptr)
 {
   using MuRT_NC   = typename MuRT::non_const_type;
   using VNT_NC    = typename VNT::non_const_type;
@@ -273,7 +259,7 @@ void read_computed_tables(const bool masterproc, const char* dir, MuRT& mu_r_tab
   VMT_NC    vm_table_vals_nc("vm_table_vals");
   RevapT_NC revap_table_vals_nc("revap_table_vals");
 
-  io_impl<true>(masterproc, dir, mu_r_table_vals_nc, vn_table_vals_nc, vm_table_vals_nc, revap_table_vals_nc);
+  io_impl<true>(masterproc, dir, mu_r_table_vals_nc, vn_table_vals_nc, vm_table_vals_nc, revap_table_vals_nc, comm);
 
   mu_r_table_vals = mu_r_table_vals_nc;
   vn_table_vals = vn_table_vals_nc;
@@ -312,28 +298,27 @@ void compute_dnu(DnuT& dnu_table_vals)
   dnu_table_vals = DnuT(dnu_table_vals_non_const);
 }
 
-}
-
-/*
- * Implementation of p3 init. Clients should NOT #include
- * this file, #include p3_functions.hpp instead.
- */
 template <typename S, typename D>
-typename Functions<S,D>::P3LookupTables Functions<S,D>
-::p3_init (const bool write_tables, const bool masterproc) {
-  P3LookupTables lookup_tables; // This struct could be our global singleton
+typename Functions<S,D>::P3LookupTables
+p3_init_impl (const bool write_tables, const bool masterproc, const ekat::Comm* comm)
+{
+  using P3F = Functions<S,D>;
+  using P3C = typename P3F::P3C;
+
+  typename P3F::P3LookupTables lookup_tables; // This struct could be our global singleton
   auto version = P3C::p3_version;
   auto p3_lookup_base = P3C::p3_lookup_base;
   static const char* dir = SCREAM_DATA_DIR "/tables";
   // p3_init_a (reads ice_table, collect_table)
-  read_ice_lookup_tables<S>(masterproc, p3_lookup_base, version, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize);
+  read_ice_lookup_tables<S>(masterproc, p3_lookup_base, version, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize,
+                            comm, /* write_bin_cache = */ write_tables);
   if (write_tables) {
     //p3_init_b (computes tables mu_r_table, revap_table, vn_table, vm_table)
     compute_tables<S, P3C>(masterproc, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
     write_computed_tables(masterproc, dir, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
   }
   else {
-    read_computed_tables(masterproc, dir, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
+    read_computed_tables(masterproc, dir, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals, comm);
   }
   // dnu is always computed/hardcoded
   compute_dnu<S>(lookup_tables.dnu_table_vals);
@@ -341,6 +326,24 @@ typename Functions<S,D>::P3LookupTables Functions<S,D>
   return lookup_tables;
 }
 
+}
+
+/*
+ * Implementation of p3 init. Clients should NOT #include
+ * this file, #include p3_functions.hpp instead.
+ */
+template <typename S, typename D>
+typename Functions<S,D>::P3LookupTables Functions<S,D>
+::p3_init (const bool write_tables, const bool masterproc) {
+  return p3_init_impl<S,D>(write_tables, masterproc, nullptr);
+}
+
+template <typename S, typename D>
+typename Functions<S,D>::P3LookupTables Functions<S,D>
+::p3_init (const ekat::Comm& comm) {
+  return p3_init_impl<S,D>(/* write_tables = */ false, comm.am_i_root(), &comm);
+}
+
 } // namespace p3
 } // namespace scream
 
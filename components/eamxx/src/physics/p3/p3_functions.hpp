@@ -7,6 +7,7 @@
 
 #include <ekat_pack_kokkos.hpp>
 #include <ekat_parameter_list.hpp>
+#include <ekat_comm.hpp>
 #include <ekat_workspace.hpp>
 
 namespace scream
@@ -396,6 +397,8 @@ template <typename ScalarT, typename DeviceT> struct Functions {
                                            view_collect_table &collect_table_vals);
 
   static P3LookupTables p3_init(const bool write_tables = false, const bool masterproc = false);
+  // Like the above, but only the root rank of comm reads the tables, and broadcasts them
+  static P3LookupTables p3_init(const ekat::Comm& comm);
 
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
@@ -1,4 +1,5 @@
-// This is a tiny program that calls p3_init() to generate tables used by p3
+// This is a tiny program that calls p3_init() to generate tables used by p3.
+// It also converts the ice lookup text table into its (faster to read) binary cache.
 
 #include "physics/p3/p3_functions.hpp"
 #include "share/core/eamxx_session.hpp"
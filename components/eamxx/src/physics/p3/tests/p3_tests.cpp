@@ -3,6 +3,15 @@
 #include "p3_main_wrap.hpp"
 #include "p3_ic_cases.hpp"
 
+#include "p3_functions.hpp"
+#include "p3_ice_tables_cache.hpp"
+
+#include <ekat_comm.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+
 namespace {
 
 TEST_CASE("P3Data", "p3") {
@@ -29,6 +38,115 @@ TEST_CASE("p3_init", "p3") {
   REQUIRE(nerr == 0);
 }
 
+TEST_CASE("p3_init_comm", "p3") {
+  using P3F = scream::p3::Functions<scream::Real, scream::DefaultDevice>;
+
+  // Tables read by the root rank and broadcast must match the ones read by each rank
+  ekat::Comm comm(MPI_COMM_WORLD);
+  const auto tables      = P3F::p3_init();
+  const auto tables_comm = P3F::p3_init(comm);
+
+  auto check = [](const auto& v, const auto& v_comm) {
+    const auto v_h      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+    const auto v_comm_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v_comm);
+    REQUIRE (v_h.size()==v_comm_h.size());
+    for (size_t i=0; i<v_h.size(); ++i) {
+      REQUIRE (v_h.data()[i]==v_comm_h.data()[i]);
+    }
+  };
+  check(tables.ice_table_vals, tables_comm.ice_table_vals);
+  check(tables.collect_table_vals, tables_comm.collect_table_vals);
+  check(tables.vn_table_vals, tables_comm.vn_table_vals);
+  check(tables.vm_table_vals, tables_comm.vm_table_vals);
+  check(tables.revap_table_vals, tables_comm.revap_table_vals);
+  check(tables.mu_r_table_vals, tables_comm.mu_r_table_vals);
+}
+
+TEST_CASE("p3_ice_tables_cache", "p3") {
+  using P3F   = scream::p3::Functions<scream::Real, scream::DefaultDevice>;
+  using P3C   = typename P3F::P3C;
+  using IceH  = typename P3F::view_ice_table::non_const_type::HostMirror;
+  using CollH = typename P3F::view_collect_table::non_const_type::HostMirror;
+  using namespace scream::p3;
+
+  const std::string text = std::string(P3C::p3_lookup_base) + P3C::p3_version;
+  const char* version = P3C::p3_version;
+
+  // Other instances of this test may run at the same time in the same folder
+  const std::string bin = "p3_ice_tables_cache_test_" + std::to_string(std::random_device{}()) + ".bin";
+
+  IceH  ice_ref("ice_ref"), ice("ice");
+  CollH coll_ref("coll_ref"), coll("coll");
+  parse_ice_lookup_tables_text(text, version, ice_ref, coll_ref, P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize);
+
+  auto load = [&](const bool write_bin_cache) {
+    Kokkos::deep_copy(ice,0);
+    Kokkos::deep_copy(coll,0);
+    return load_ice_lookup_tables(false, text, bin, version, ice, coll,
+                                  P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize, write_bin_cache);
+  };
+  auto check = [&]() {
+    for (size_t i=0; i<ice.size(); ++i) {
+      REQUIRE (ice.data()[i]==ice_ref.data()[i]);
+    }
+    for (size_t i=0; i<coll.size(); ++i) {
+      REQUIRE (coll.data()[i]==coll_ref.data()[i]);
+    }
+  };
+  auto file_size = [&]() {
+    std::ifstream f(bin, std::ios::binary | std::ios::ate);
+    return static_cast<size_t>(f.tellg());
+  };
+
+  SECTION ("round_trip") {
+    // Writing the cache parses the text table
+    REQUIRE (not load(true));
+    check();
+    // Afterwards, the cache is used
+    REQUIRE (load(false));
+    check();
+  }
+
+  SECTION ("version_mismatch") {
+    write_ice_lookup_tables_bin(bin, "0.0.0", ice_ref, coll_ref);
+    REQUIRE (not load(false));
+    check();
+  }
+
+  SECTION ("corrupted") {
+    write_ice_lookup_tables_bin(bin, version, ice_ref, coll_ref);
+    {
+      // Flip some bits in the payload: the checksum no longer matches
+      std::fstream f(bin, std::ios::binary | std::ios::in | std::ios::out);
+      f.seekg(sizeof(IceTablesBinHeader) + 100);
+      char c;
+      f.get(c);
+      f.seekp(sizeof(IceTablesBinHeader) + 100);
+      f.put(c ^ 0x5a);
+    }
+    REQUIRE (not load(false));
+    check();
+  }
+
+  SECTION ("truncated") {
+    write_ice_lookup_tables_bin(bin, version, ice_ref, coll_ref);
+    const auto size = file_size();
+    std::vector<char> bytes(size/2);
+    {
+      std::ifstream f(bin, std::ios::binary);
+      f.read(bytes.data(), bytes.size());
+    }
+    {
+      std::ofstream f(bin, std::ios::binary | std::ios::trunc);
+      f.write(bytes.data(), bytes.size());
+    }
+    REQUIRE (not load(false));
+    check();
+  }
+
+  std::remove(bin.c_str());
+}
+
 TEST_CASE("p3_ic_c", "p3") {
   int nerr = scream::p3::test_p3_ic();
   REQUIRE(nerr == 0);
@@ -5,15 +5,46 @@
 
 #include <ekat_assert.hpp>
 
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+
 namespace scream {
 
 // Struct which allows for the allocation of a single
 // memory buffer for all ATM processes.
+//
+// Clients (i.e., atm processes) request memory by name, and obtain a
+// manager restricted to their own portion of the buffer via get_client_buffer.
+// The buffer is split into two arenas:
+//  - Shared: all clients start at the beginning of the arena, so the arena
+//    size is the max of the requests. Since clients overwrite each other's
+//    memory, no two shared clients can run at the same time.
+//  - Private: each client gets its own slice, so the arena size is the sum
+//    of the requests. Clients in this arena can run concurrently with anyone.
+// Each client portion starts at an address that is a multiple of 'alignment'.
+//
+// For debugging, the manager can poison a client memory before it runs, and
+// detect how much of it was actually written after it ran (see usage_report).
 struct ATMBufferManager {
 
   template <typename S>
   using view_1d = typename KokkosTypes<DefaultDevice>::template view_1d<S>;
 
+  enum Arena : int {
+    Shared  = 0,
+    Private = 1
+  };
+
+  // Alignment (in bytes) of each client portion. A GPU cache line,
+  // which is also a multiple of sizeof(Pack) for all pack sizes we use.
+  static constexpr size_t alignment = 128;
+
+  // Value used to fill memory when poisoning is on
+  static constexpr Real poison_value = -1.234567e30;
+
   ATMBufferManager()
   {
     m_size      = 0;
@@ -27,6 +58,7 @@ struct ATMBufferManager {
   // the same time, the total allocation will be the maximum
   // of each request.
   void request_bytes (const size_t num_bytes) {
+    EKAT_REQUIRE_MSG (!m_allocated, "Error! Cannot request memory after 'allocate' was called.\n");
     EKAT_REQUIRE_MSG (num_bytes%sizeof(Real)==0,
         "Error! Must request number of bytes which is divisible by sizeof(Real).\n");
 
@@ -34,24 +66,191 @@ struct ATMBufferManager {
     m_size = std::max(num_reals, m_size);
   }
 
-  Real* get_memory () const { return m_buffer.data(); }
+  // Same as above, but the request is recorded under the client name, so that
+  // the client can later retrieve its portion of the buffer (and appear in the
+  // usage report). Multiple requests from the same client yield the max.
+  void request_bytes (const std::string& client, const size_t num_bytes, const Arena arena = Shared) {
+    EKAT_REQUIRE_MSG (!m_allocated, "Error! Cannot request memory after 'allocate' was called.\n");
+    EKAT_REQUIRE_MSG (num_bytes%sizeof(Real)==0,
+        "Error! Must request number of bytes which is divisible by sizeof(Real).\n"
+        "  - client: " + client + "\n"
+        "  - bytes : " + std::to_string(num_bytes) + "\n");
+
+    auto it = m_clients.find(client);
+    if (it==m_clients.end()) {
+      it = m_clients.emplace(client,ClientInfo()).first;
+      it->second.arena = arena;
+    }
+    auto& info = it->second;
+    EKAT_REQUIRE_MSG (info.arena==arena,
+        "Error! Client requested memory from two different arenas.\n"
+        "  - client: " + client + "\n");
+    info.requested_bytes = std::max(info.requested_bytes,num_bytes);
+  }
+
+  Real* get_memory () const { return m_buffer.data() + m_offset; }
 
+  // Bytes available starting at get_memory(). For the top-level manager,
+  // this is the size of the shared arena.
   size_t allocated_bytes () const { return m_size*sizeof(Real); }
 
+  // Bytes allocated across both arenas (including alignment padding)
+  size_t total_allocated_bytes () const { return m_buffer.size()*sizeof(Real); }
+
   void allocate () {
     EKAT_REQUIRE_MSG (!m_allocated, "Error! Cannot call 'allocate' more than once.\n");
 
-    m_buffer = view_1d<Real>("",m_size);
+    // Shared arena first, then the private slices, each rounded up to the alignment
+    m_size = align(m_size);
+    for (auto& it : m_clients) {
+      auto& info = it.second;
+      info.size = align(info.requested_bytes/sizeof(Real));
+      if (info.arena==Shared) {
+        m_size = std::max(m_size,info.size);
+      }
+    }
+    size_t private_size = 0;
+    for (auto& it : m_clients) {
+      auto& info = it.second;
+      if (info.arena==Private) {
+        info.offset = m_size + private_size;
+        private_size += info.size;
+      }
+    }
+
+    // Kokkos only guarantees a smaller alignment for the allocation itself,
+    // so allocate some slack and shift the start of the buffer
+    constexpr size_t slack = alignment/sizeof(Real);
+    m_buffer = view_1d<Real>("ATMBufferManager",m_size+private_size+slack);
+    const auto addr = reinterpret_cast<std::uintptr_t>(m_buffer.data());
+    m_offset = ((alignment - addr%alignment) % alignment) / sizeof(Real);
     m_allocated = true;
   }
 
   bool allocated () const { return m_allocated; }
 
+  // Return a manager whose memory is the portion of this buffer reserved to the
+  // given client. Clients that did not request memory by name get the shared arena.
+  ATMBufferManager get_client_buffer (const std::string& client) const {
+    EKAT_REQUIRE_MSG (m_allocated, "Error! Cannot get client buffers before calling 'allocate'.\n");
+
+    ATMBufferManager bm;
+    bm.m_buffer    = m_buffer;
+    bm.m_offset    = m_offset;
+    bm.m_size      = m_size;
+    bm.m_allocated = true;
+    auto it = m_clients.find(client);
+    if (it!=m_clients.end() && it->second.arena==Private) {
+      bm.m_offset += it->second.offset;
+      bm.m_size    = it->second.size;
+    }
+    return bm;
+  }
+
+  // Poisoning: if on, the atm process groups call poison before running a client,
+  // and record_usage after, to track the number of bytes each client actually writes.
+  void set_poisoning (const bool poison) { m_poison = poison; }
+  bool poisoning () const { return m_poison; }
+
+  // Fill the memory the client can use with poison_value. For shared clients,
+  // this is the whole shared arena, so that writes past the requested size are
+  // detected. For private clients, it is their slice only.
+  void poison (const std::string& client) const {
+    auto it = m_clients.find(client);
+    if (it==m_clients.end()) {
+      return;
+    }
+    Kokkos::deep_copy(client_range(it->second),poison_value);
+  }
+
+  // Update the max number of bytes written by the client since the last poison.
+  // Poisoned entries left untouched past the last written one do not count as used.
+  void record_usage (const std::string& client) {
+    auto it = m_clients.find(client);
+    if (it==m_clients.end()) {
+      return;
+    }
+    auto& info = it->second;
+    const auto mem = client_range(info);
+
+    // The identity of Kokkos::Max is the lowest int, so skip empty ranges, and
+    // let untouched entries contribute 0 rather than nothing.
+    int last_used = 0;
+    if (mem.extent(0)>0) {
+      using policy_t = Kokkos::RangePolicy<typename KokkosTypes<DefaultDevice>::ExeSpace>;
+      Kokkos::parallel_reduce("ATMBufferManager::record_usage",policy_t(0,mem.extent(0)),
+                              KOKKOS_LAMBDA (const int i, int& last) {
+        const int used = mem(i)!=poison_value ? i+1 : 0;
+        if (used>last) {
+          last = used;
+        }
+      },Kokkos::Max<int>(last_used));
+    }
+    info.used_bytes = std::max(info.used_bytes,static_cast<long long>(last_used*sizeof(Real)));
+  }
+
+  // Table of requested, allocated, and (if poisoning is on) used bytes per client.
+  // Shared clients that used more than they requested are flagged.
+  std::string usage_report () const {
+    std::string peak;
+    size_t peak_bytes = 0;
+    for (const auto& it : m_clients) {
+      if (it.second.arena==Shared && it.second.requested_bytes>=peak_bytes) {
+        peak = it.first;
+        peak_bytes = it.second.requested_bytes;
+      }
+    }
+
+    std::stringstream ss;
+    ss << "ATMBufferManager: shared arena " << allocated_bytes()
+       << " bytes, total " << total_allocated_bytes() << " bytes\n";
+    ss << "  " << std::left << std::setw(32) << "client" << std::setw(9) << "arena"
+       << std::right << std::setw(14) << "requested" << std::setw(14) << "used" << "\n";
+    for (const auto& it : m_clients) {
+      const auto& info = it.second;
+      ss << "  " << std::left << std::setw(32) << it.first
+         << std::setw(9) << (info.arena==Shared ? "shared" : "private")
+         << std::right << std::setw(14) << info.requested_bytes
+         << std::setw(14) << (info.used_bytes>=0 ? std::to_string(info.used_bytes) : "n/a");
+      if (info.used_bytes>static_cast<long long>(info.requested_bytes)) {
+        ss << "  <-- exceeds request";
+      }
+      if (it.first==peak) {
+        ss << "  <-- shared arena peak";
+      }
+      ss << "\n";
+    }
+    return ss.str();
+  }
+
 protected:
 
+  struct ClientInfo {
+    Arena     arena = Shared;
+    size_t    requested_bytes = 0;
+    size_t    size   = 0;   // Allocated size (in Reals), including alignment padding
+    size_t    offset = 0;   // Offset (in Reals) from the start of the (aligned) buffer
+    long long used_bytes = -1;
+  };
+
+  static size_t align (const size_t num_reals) {
+    constexpr size_t n = alignment/sizeof(Real);
+    return ((num_reals+n-1)/n)*n;
+  }
+
+  view_1d<Real> client_range (const ClientInfo& info) const {
+    const size_t beg = m_offset + (info.arena==Shared ? 0 : info.offset);
+    const size_t len = info.arena==Shared ? m_size : info.size;
+    return Kokkos::subview(m_buffer,Kokkos::make_pair(beg,beg+len));
+  }
+
   view_1d<Real> m_buffer;
   size_t        m_size;
+  size_t        m_offset = 0;
   bool          m_allocated;
+  bool          m_poison = false;
+
+  std::map<std::string,ClientInfo> m_clients;
 };
 
 } // scream
@@ -14,6 +14,9 @@ namespace py = pybind11;
 
 #include <ekat_assert.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -62,6 +65,45 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
       "Error! Invalid number of subcycles in param list " + m_params.name() + ".\n"
       "  - Num subcycles: " + std::to_string(m_num_subcycles) + "\n");
 
+  m_run_freq = m_params.get<int>("run_frequency",1);
+  m_run_freq_units = m_params.get<std::string>("run_frequency_units","nsteps");
+  EKAT_REQUIRE_MSG (m_run_freq>0,
+      "Error! Invalid run frequency in param list " + m_params.name() + ".\n"
+      "  - Run frequency: " + std::to_string(m_run_freq) + "\n");
+  EKAT_REQUIRE_MSG (ekat::contains(std::vector<std::string>{"nsteps","nsecs","nmins","nhours"},m_run_freq_units),
+      "Error! Invalid run frequency units in param list " + m_params.name() + ".\n"
+      "  - Run frequency units: " + m_run_freq_units + "\n"
+      "  - Valid values: nsteps, nsecs, nmins, nhours\n");
+
+  m_adaptive_subcycling = m_params.get<bool>("adaptive_subcycling",false);
+  if (m_adaptive_subcycling) {
+    m_min_subcycles = m_params.get<int>("min_number_of_subcycles",1);
+    m_max_subcycles = m_params.get<int>("max_number_of_subcycles",m_num_subcycles);
+    m_target_stability_metric = m_params.get<Real>("target_stability_metric",1);
+    EKAT_REQUIRE_MSG (m_min_subcycles>0 and m_min_subcycles<=m_num_subcycles and m_num_subcycles<=m_max_subcycles,
+        "Error! Invalid adaptive subcycling bounds in param list " + m_params.name() + ".\n"
+        "  - Min num subcycles: " + std::to_string(m_min_subcycles) + "\n"
+        "  - Num subcycles    : " + std::to_string(m_num_subcycles) + "\n"
+        "  - Max num subcycles: " + std::to_string(m_max_subcycles) + "\n");
+    EKAT_REQUIRE_MSG (m_target_stability_metric>0,
+        "Error! Invalid target stability metric in param list " + m_params.name() + ".\n"
+        "  - Target stability metric: " + std::to_string(m_target_stability_metric) + "\n");
+  }
+
+  // Save the run counters in restart files, so that restarted runs keep running
+  // the process on the same steps, and with the same number of subcycles.
+  // NOTE: name() is virtual, so use the param list name, which is the process name.
+  if (m_run_freq!=1 or m_run_freq_units!="nsteps") {
+    m_num_run_calls_rest = std::make_shared<std::any>(std::make_any<std::int64_t>(0));
+    m_restart_extra_data[m_params.name()+"_num_run_calls"] = m_num_run_calls_rest;
+  }
+  if (m_adaptive_subcycling) {
+    m_num_subcycles_rest = std::make_shared<std::any>(std::make_any<int>(m_num_subcycles));
+    m_restart_extra_data[m_params.name()+"_num_subcycles"] = m_num_subcycles_rest;
+  }
+
+  m_private_scratch = m_params.get<bool>("private_scratch",false);
+
   m_timer_prefix = m_params.get<std::string>("timer_prefix","EAMxx::");
 
   m_repair_log_level = str2LogLevel(m_params.get<std::string>("repair_log_level","warn"));
@@ -131,6 +173,16 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 
   set_fields_and_groups_pointers();
   m_start_of_step_ts = m_end_of_step_ts = t0;
+  // On restart, the driver already read the run counters from the restart file
+  m_num_run_calls = 0;
+  if (run_type==RunType::Restart) {
+    if (m_num_run_calls_rest) {
+      m_num_run_calls = std::any_cast<std::int64_t>(*m_num_run_calls_rest);
+    }
+    if (m_num_subcycles_rest) {
+      m_num_subcycles = std::any_cast<int>(*m_num_subcycles_rest);
+    }
+  }
   initialize_impl(run_type);
 
   // Avoid logging and flushing if ap type is diag ...
@@ -147,7 +199,14 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
   }
 }
 
+std::int64_t AtmosphereProcess::s_num_runs_started = 0;
+
 void AtmosphereProcess::run (const double dt) {
+  ++s_num_runs_started;
+  if (not is_run_step(dt)) {
+    skip_run(dt);
+    return;
+  }
   m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
   start_timer (m_timer_prefix + this->name() + "::run");
   if (m_params.get("enable_precondition_checks", true)) {
@@ -161,6 +220,11 @@ void AtmosphereProcess::run (const double dt) {
   // Init single step tendencies (if any) with current value of output field
   init_step_tendencies ();
 
+  // Save the start-of-run state of fields whose tendency we reapply on skipped steps
+  for (auto& ct : m_cached_tendencies) {
+    ct.f_beg.deep_copy(ct.f);
+  }
+
   for (m_subcycle_iter=0; m_subcycle_iter<m_num_subcycles; ++m_subcycle_iter) {
     m_start_of_step_ts = m_end_of_step_ts;
     m_end_of_step_ts += dt_sub;
@@ -209,6 +273,16 @@ void AtmosphereProcess::run (const double dt) {
   // Complete tendency calculations (if any)
   compute_step_tendencies();
 
+  for (auto& ct : m_cached_tendencies) {
+    ct.tend.deep_copy(ct.f);
+    ct.tend.update(ct.f_beg,-1/dt,1/dt);
+    ct.tend.get_header().get_tracking().update_time_stamp(m_end_of_step_ts);
+  }
+
+  if (m_adaptive_subcycling) {
+    update_num_subcycles();
+  }
+
   if (m_params.get("enable_postcondition_checks", true)) {
     // Run 'post-condition' property checks stored in this AP
     run_postcondition_checks();
@@ -221,6 +295,107 @@ void AtmosphereProcess::run (const double dt) {
   stop_timer (m_timer_prefix + this->name() + "::run");
 }
 
+bool AtmosphereProcess::is_run_step (const double dt) {
+  if (m_run_freq_steps<0) {
+    if (m_run_freq_units=="nsteps") {
+      m_run_freq_steps = m_run_freq;
+    } else {
+      const int factor = m_run_freq_units=="nhours" ? 3600 : (m_run_freq_units=="nmins" ? 60 : 1);
+      const double freq_secs = static_cast<double>(m_run_freq)*factor;
+      m_run_freq_steps = std::lround(freq_secs/dt);
+      EKAT_REQUIRE_MSG (m_run_freq_steps>0 and std::abs(m_run_freq_steps*dt-freq_secs)<1e-6*freq_secs,
+          "Error! The run frequency must be a multiple of the timestep.\n"
+          "  - Atm process  : " + name() + "\n"
+          "  - Run frequency: " + std::to_string(m_run_freq) + " " + m_run_freq_units + "\n"
+          "  - Timestep [s] : " + std::to_string(dt) + "\n");
+    }
+  }
+  const bool run = (m_num_run_calls++ % m_run_freq_steps)==0;
+  if (m_num_run_calls_rest) {
+    std::any_cast<std::int64_t&>(*m_num_run_calls_rest) = m_num_run_calls;
+  }
+  return run;
+}
+
+void AtmosphereProcess::skip_run (const double dt) {
+  m_atm_logger->debug("[EAMxx::" + this->name() + "] skipping run (run frequency: "
+                      + std::to_string(m_run_freq_steps) + " steps)");
+
+  init_step_tendencies ();
+
+  // Advance our timestamps as run would (including num_steps)
+  const auto dt_sub = dt / m_num_subcycles;
+  for (int i=0; i<m_num_subcycles; ++i) {
+    m_start_of_step_ts = m_end_of_step_ts;
+    m_end_of_step_ts += dt_sub;
+  }
+
+  // Fields without a cached tendency keep the value of the last run
+  for (auto& ct : m_cached_tendencies) {
+    ct.f.update(ct.tend,dt,1);
+    if (m_update_time_stamps) {
+      ct.f.get_header().get_tracking().update_time_stamp(m_end_of_step_ts);
+    }
+  }
+
+  compute_step_tendencies();
+}
+
+void AtmosphereProcess::setup_cached_tendencies () {
+  using strvec_t = std::vector<std::string>;
+  auto tend_vec = m_params.get<strvec_t>("reapply_tendencies",{});
+  if (tend_vec.size()==0) {
+    return;
+  }
+  EKAT_REQUIRE_MSG (m_run_freq!=1 or m_run_freq_units!="nsteps",
+      "Error! Tendencies reapplication requested, but the process runs every step.\n"
+      "  - Atm process: " + name() + "\n");
+
+  set_fields_and_groups_pointers ();
+
+  for (const auto& tn : tend_vec) {
+    // Allow 'field_name@grid_name' syntax, as in compute_tendencies
+    auto tokens = ekat::split(tn,'@');
+    EKAT_REQUIRE_MSG (tokens.size()==1 || tokens.size()==2,
+        "Error! Invalid format for tendency reapplication request: " + tn + "\n"
+        "  To reapply tendencies for F, use 'F' or 'F@grid_name' format.\n");
+    const auto& f = tokens.size()==2 ? get_field_out(tokens[0],tokens[1]) : get_field_out(tokens[0]);
+    EKAT_REQUIRE_MSG (has_required_field(f.get_header().get_identifier()),
+        "Error! Tendencies can only be reapplied to fields updated by the atm process.\n"
+        "  - Atm process: " + name() + "\n"
+        "  - Field name : " + f.name() + "\n");
+
+    auto& ct = m_cached_tendencies.emplace_back();
+    ct.f = f;
+    ct.f_beg = f.clone();
+    // The tendency must be restarted, or a restart on a skipped step would not be BFB
+    ct.tend = f.clone(this->name() + "_" + f.name() + "_cached_tend");
+    ct.tend.deep_copy(0);
+    add_internal_field(ct.tend,{"RESTART"});
+  }
+}
+
+void AtmosphereProcess::update_num_subcycles () {
+  // Use the same number of subcycles on all ranks, in case run_impl has collectives
+  Real metric = get_stability_metric();
+  Real global_metric;
+  m_comm.all_reduce(&metric,&global_metric,1,MPI_MAX);
+  EKAT_REQUIRE_MSG (global_metric>=0,
+      "Error! Adaptive subcycling was requested, but the atm process does not provide a stability metric.\n"
+      "  - Atm process: " + name() + "\n");
+
+  // The metric was computed with the current subcycle length; assume it is proportional to it
+  const int needed = static_cast<int>(std::ceil(m_num_subcycles*global_metric/m_target_stability_metric));
+  const int nsub = std::clamp(needed,m_min_subcycles,m_max_subcycles);
+  if (nsub!=m_num_subcycles) {
+    log (LogLevel::debug,"[" + name() + "] number of subcycles changed from "
+         + std::to_string(m_num_subcycles) + " to " + std::to_string(nsub)
+         + " (stability metric: " + std::to_string(global_metric) + ")");
+    m_num_subcycles = nsub;
+    std::any_cast<int&>(*m_num_subcycles_rest) = nsub;
+  }
+}
+
 void AtmosphereProcess::finalize () {
   finalize_impl(/* what inputs? */);
 #ifdef EAMXX_HAS_PYTHON
@@ -239,6 +414,9 @@ void AtmosphereProcess::finalize () {
 }
 
 void AtmosphereProcess::setup_step_tendencies (const std::string& default_grid) {
+  // Not a step tendency per se, but it also has to create internal fields by now
+  setup_cached_tendencies();
+
   using strvec_t = std::vector<std::string>;
   auto tend_vec = m_params.get<strvec_t>("compute_tendencies",{});
   if (tend_vec.size()==0) {
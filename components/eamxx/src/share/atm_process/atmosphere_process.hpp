@@ -28,6 +28,7 @@ class array;
 #include <set>
 #include <any>
 #include <list>
+#include <cstdint>
 #include <any>
 
 namespace scream
@@ -125,6 +126,10 @@ public:
 
   bool is_initialized () const { return m_is_initialized; }
 
+  // Number of times the run method of any atm process (including groups) has been called.
+  // Processes can use it to detect whether any other process ran since they last did.
+  static std::int64_t num_runs_started () { return s_num_runs_started; }
+
   // Return the MPI communicator
   const ekat::Comm& get_comm () const { return m_comm; }
 
@@ -215,6 +220,14 @@ public:
   // Computes total number of bytes needed for local variables
   virtual size_t requested_buffer_size_in_bytes () const { return 0; }
 
+  // Registers this process' buffer request with the buffer manager. Processes with
+  // private_scratch=true get their own slice of the buffer, rather than sharing
+  // memory with all other processes.
+  virtual void request_buffers (ATMBufferManager& buffer_manager) const {
+    buffer_manager.request_bytes(name(),requested_buffer_size_in_bytes(),
+                                 m_private_scratch ? ATMBufferManager::Private : ATMBufferManager::Shared);
+  }
+
   // Set local variables using memory provided by
   // the ATMBufferManager
   virtual void init_buffers(const ATMBufferManager& /* buffer_manager */) {
@@ -318,6 +331,11 @@ protected:
   int get_subcycle_iter () const { return m_subcycle_iter; }
   bool do_update_time_stamp () const { return m_update_time_stamps; }
 
+  // Processes that support adaptive subcycling override this, returning a
+  // stability metric of the last run (e.g., a CFL number), computed with the
+  // current subcycle length. A negative value means "not available".
+  virtual Real get_stability_metric () const { return -1; }
+
   int get_internal_diagnostics_level () const { return m_internal_diagnostics_level; }
 
   // Derived classes can used these method, so that if we change how fields/groups
@@ -534,6 +552,17 @@ private:
 
   void fix_energy (const double dt, const bool water_thermo_fixer, const bool print_debug_info);
 
+  // Run frequency control: returns whether this call to run should run the process.
+  // On skipped calls, skip_run advances the timestamps and reapplies cached tendencies.
+  bool is_run_step (const double dt);
+  void skip_run (const double dt);
+
+  // Store fields needed to reapply tendencies on skipped steps (if any requested)
+  void setup_cached_tendencies ();
+
+  // Adjust the number of subcycles based on the stability metric of the last run
+  void update_num_subcycles ();
+
   // Run an individual property check. The input property_check_category_name
   void run_property_check (const prop_check_ptr&       property_check,
                            const CheckFailHandling     check_fail_handling,
@@ -555,6 +584,14 @@ private:
   strmap_t<Field>    m_proc_tendencies;
   strmap_t<Field>    m_start_of_step_fields;
 
+  // Tendencies of the last run, reapplied on steps where the process does not run
+  struct CachedTendency {
+    Field f;      // The updated field
+    Field f_beg;  // The field at the beginning of the last run
+    Field tend;   // (f_end - f_beg) / dt over the last run
+  };
+  std::vector<CachedTendency> m_cached_tendencies;
+
   // These maps help to retrieve a field/group stored in the lists above. E.g.,
   //   auto ptr = m_field_in_pointers[field_name][grid_name];
   // then *ptr is a field in m_fields_in, with name $field_name, on grid $grid_name.
@@ -592,6 +629,31 @@ private:
   // The number of times this process needs to be subcycled
   int m_num_subcycles = 1;
 
+  // The process runs once every m_run_freq_steps calls to run. The frequency
+  // can be given in steps or in time units, in which case m_run_freq_steps
+  // is computed at the first call to run (which gives us the timestep).
+  int           m_run_freq = 1;
+  std::string   m_run_freq_units = "nsteps";
+  int           m_run_freq_steps = -1;
+  std::int64_t  m_num_run_calls = 0;
+
+  // Restart extra data holding copies of m_num_run_calls and (with adaptive subcycling)
+  // m_num_subcycles. They cannot be deduced from the restart time stamp, since, e.g.,
+  // processes in a subcycled group are run several times per atm step.
+  std::shared_ptr<std::any> m_num_run_calls_rest;
+  std::shared_ptr<std::any> m_num_subcycles_rest;
+
+  // Adaptive subcycling: after each run, the number of subcycles is set so that
+  // the stability metric (see get_stability_metric) stays below the target
+  bool m_adaptive_subcycling = false;
+  int  m_min_subcycles = 1;
+  int  m_max_subcycles = 1;
+  Real m_target_stability_metric = 1;
+
+  // Whether this process' scratch memory is carved from the private arena
+  // of the ATMBufferManager (see request_buffers)
+  bool m_private_scratch = false;
+
   bool m_is_initialized = false;
 
   // This can be queried by derived classes, in case they need to know which
@@ -601,6 +663,9 @@ private:
   // Whether we need to update time stamps at the end of the run method
   bool m_update_time_stamps = true;
 
+  // Incremented at the beginning of each call to run, by all atm processes
+  static std::int64_t s_num_runs_started;
+
   // Log level for when property checks perform a repair
   ekat::logger::LogLevel  m_repair_log_level;
 
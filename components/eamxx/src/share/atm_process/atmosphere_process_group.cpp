@@ -440,8 +440,16 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
                       (get_subcycle_iter()==get_num_subcycles()-1);
   for (auto atm_proc : m_atm_processes) {
     atm_proc->set_update_time_stamps(do_update);
+    const bool track_buffer = m_buffer_manager and m_buffer_manager->poisoning() and
+                              atm_proc->type()!=AtmosphereProcessType::Group;
+    if (track_buffer) {
+      m_buffer_manager->poison(atm_proc->name());
+    }
     // Run the process
     atm_proc->run(dt);
+    if (track_buffer) {
+      m_buffer_manager->record_usage(atm_proc->name());
+    }
 #ifdef SCREAM_HAS_MEMORY_USAGE
     long long my_mem_usage = get_mem_usage(MB);
     long long max_mem_usage;
@@ -675,10 +683,33 @@ size_t AtmosphereProcessGroup::requested_buffer_size_in_bytes () const
   return buf_size;
 }
 
+void AtmosphereProcessGroup::
+request_buffers (ATMBufferManager& buffer_manager) const
+{
+  for (const auto& proc : m_atm_processes) {
+    proc->request_buffers(buffer_manager);
+  }
+}
+
 void AtmosphereProcessGroup::
 init_buffers(const ATMBufferManager& buffer_manager) {
   for (auto& atm_proc : m_atm_processes) {
-    atm_proc->init_buffers(buffer_manager);
+    if (atm_proc->type()==AtmosphereProcessType::Group) {
+      atm_proc->init_buffers(buffer_manager);
+    } else {
+      atm_proc->init_buffers(buffer_manager.get_client_buffer(atm_proc->name()));
+    }
+  }
+}
+
+void AtmosphereProcessGroup::
+set_buffer_manager (const std::shared_ptr<ATMBufferManager>& buffer_manager) {
+  m_buffer_manager = buffer_manager;
+  for (auto& atm_proc : m_atm_processes) {
+    auto apg = std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_proc);
+    if (apg) {
+      apg->set_buffer_manager(buffer_manager);
+    }
   }
 }
 
@@ -71,10 +71,17 @@ public:
   // Computes total number of bytes needed for local variables
   size_t requested_buffer_size_in_bytes () const;
 
+  // Register the buffer requests of all processes in the group
+  void request_buffers (ATMBufferManager& buffer_manager) const;
+
   // Set local variables using memory provided by
-  // the ATMBufferManager
+  // the ATMBufferManager. Each process gets its own portion of the buffer.
   void init_buffers(const ATMBufferManager& buffer_manager);
 
+  // If the buffer manager has poisoning on, the group poisons each process'
+  // buffer before running it, and records how much of it was used afterwards
+  void set_buffer_manager (const std::shared_ptr<ATMBufferManager>& buffer_manager);
+
   // The APG class needs to perform special checks before establishing whether
   // a required group/field is indeed a required group for this APG
   void set_required_field (const Field& field);
@@ -142,6 +149,9 @@ protected:
 
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
+
+  // Only used to track buffer usage (see set_buffer_manager)
+  std::shared_ptr<ATMBufferManager> m_buffer_manager;
 };
 
 } // namespace scream
@@ -181,6 +181,19 @@ protected:
   }
 };
 
+// Like AddOne, but with a stability metric that requires at least 6 subcycles
+class AddOneStable : public AddOne
+{
+public:
+  AddOneStable (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : AddOne(comm,params)
+  {
+    // Nothing to do here
+  }
+protected:
+  Real get_stability_metric () const override { return Real(6) / get_num_subcycles(); }
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -348,4 +361,215 @@ TEST_CASE ("subcycling") {
   }
 }
 
+TEST_CASE ("run_frequency") {
+  using namespace scream;
+
+  using strvec_t = std::vector<std::string>;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  const int nlcols = 3;
+  const int nlevs = 10;
+  auto grid = create_point_grid ("point_grid",nlcols*comm.size(),nlevs,comm);
+  auto gm = std::make_shared<LibraryGridsManager>(grid);
+
+  ekat::ParameterList params, params_freq, params_reapply, params_adapt;
+  params.set<std::string>("grid_name", "point_grid");
+  params_freq.set<std::string>("grid_name", "point_grid");
+  params_freq.set<int>("run_frequency", 3);
+  params_reapply.set<std::string>("grid_name", "point_grid");
+  params_reapply.set<int>("run_frequency", 3);
+  params_reapply.set<strvec_t>("reapply_tendencies", {"Field A"});
+  params_adapt.set<std::string>("grid_name", "point_grid");
+  params_adapt.set<bool>("adaptive_subcycling", true);
+  params_adapt.set<int>("max_number_of_subcycles", 4);
+
+  // Runs every step, every 3 steps, every 3 steps (reapplying tendencies), adaptively subcycled
+  std::vector<std::shared_ptr<AtmosphereProcess>> aps = {
+    std::make_shared<AddOne>(comm,params),
+    std::make_shared<AddOne>(comm,params_freq),
+    std::make_shared<AddOne>(comm,params_reapply),
+    std::make_shared<AddOneStable>(comm,params_adapt)
+  };
+
+  for (auto ap : aps) {
+    ap->set_grids(gm);
+    for(const auto& req : ap->get_field_requests()) {
+      Field f(req.fid);
+      f.allocate_view();
+      f.deep_copy(0);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      ap->set_required_field(f.get_const());
+      ap->set_computed_field(f);
+    }
+    ap->setup_step_tendencies("point_grid");
+    ap->initialize(t0,RunType::Initial);
+  }
+
+  auto check = [&](const int iap, const Real expected) {
+    auto v = aps[iap]->get_fields_in().front().get_view<const Real*,Host>();
+    for (size_t i=0; i<v.size(); ++i) {
+      REQUIRE (v[i]==expected);
+    }
+  };
+
+  // Run for 6 steps. The procs with run_frequency=3 run on steps 0 and 3.
+  // Note: use dt=1, so that the reapplied tendencies are exact
+  const int dt = 1;
+  for (int n=0; n<6; ++n) {
+    for (auto ap : aps) {
+      ap->run(dt);
+    }
+  }
+  check(0,6);
+  check(1,2);
+  check(2,6);
+
+  // The adaptive proc ran with 1 subcycle, then with the max allowed (4) ever since
+  check(3,1+5*4);
+
+  // Restarted procs pick up the run counter and number of subcycles from the restart
+  // extra data (which the driver reads from the restart file before initializing)
+  auto setup = [&](const std::shared_ptr<AtmosphereProcess>& ap,
+                   const std::shared_ptr<AtmosphereProcess>& src) {
+    ap->set_grids(gm);
+    for(const auto& req : ap->get_field_requests()) {
+      Field f(req.fid);
+      f.allocate_view();
+      f.deep_copy(0);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      ap->set_required_field(f.get_const());
+      ap->set_computed_field(f);
+    }
+    for (auto& [name,data] : ap->get_restart_extra_data()) {
+      *data = *src->get_restart_extra_data().at(name);
+    }
+    ap->setup_step_tendencies("point_grid");
+    ap->initialize(t0,RunType::Restart);
+  };
+  REQUIRE (aps[0]->get_restart_extra_data().size()==0);
+  REQUIRE (aps[1]->get_restart_extra_data().size()==1);
+  REQUIRE (aps[3]->get_restart_extra_data().size()==1);
+
+  // One more step, so that the restart is not on a run step of the run_frequency=3 proc
+  aps[1]->run(dt);
+  check(1,3);
+  auto freq_rest = std::make_shared<AddOne>(comm,params_freq);
+  setup(freq_rest,aps[1]);
+  for (int n=0; n<2; ++n) {
+    freq_rest->run(dt);
+    REQUIRE (freq_rest->get_fields_in().front().get_view<const Real*,Host>()[0]==0);
+  }
+  freq_rest->run(dt);
+  REQUIRE (freq_rest->get_fields_in().front().get_view<const Real*,Host>()[0]==1);
+
+  auto adapt_rest = std::make_shared<AddOneStable>(comm,params_adapt);
+  setup(adapt_rest,aps[3]);
+  REQUIRE (adapt_rest->get_num_subcycles()==4);
+
+  // With time units, run_frequency=1 can still skip steps: with dt=4s, a proc with
+  // run_frequency=1 nmins runs every 15 steps, and reapplies tendencies on the others.
+  // Note: dt is a power of 2, so that the reapplied tendencies are exact
+  ekat::ParameterList params_mins, params_mins_reapply;
+  params_mins.set<std::string>("grid_name", "point_grid");
+  params_mins.set<int>("run_frequency", 1);
+  params_mins.set<std::string>("run_frequency_units", "nmins");
+  params_mins_reapply = params_mins;
+  params_mins_reapply.set<strvec_t>("reapply_tendencies", {"Field A"});
+  std::vector<std::shared_ptr<AtmosphereProcess>> aps_mins = {
+    std::make_shared<AddOne>(comm,params_mins),
+    std::make_shared<AddOne>(comm,params_mins_reapply)
+  };
+  for (auto ap : aps_mins) {
+    ap->set_grids(gm);
+    for(const auto& req : ap->get_field_requests()) {
+      Field f(req.fid);
+      f.allocate_view();
+      f.deep_copy(0);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      ap->set_required_field(f.get_const());
+      ap->set_computed_field(f);
+    }
+    ap->setup_step_tendencies("point_grid");
+    ap->initialize(t0,RunType::Initial);
+  }
+  for (int n=0; n<30; ++n) {
+    for (auto ap : aps_mins) {
+      ap->run(4);
+    }
+  }
+  REQUIRE (aps_mins[0]->get_fields_in().front().get_view<const Real*,Host>()[0]==2);
+  REQUIRE (aps_mins[1]->get_fields_in().front().get_view<const Real*,Host>()[0]==30);
+}
+
+TEST_CASE ("buffer_manager") {
+  using BM = ATMBufferManager;
+  constexpr int nreals = BM::alignment/sizeof(Real);
+
+  BM bm;
+  bm.request_bytes("shared_a",10*sizeof(Real));
+  bm.request_bytes("shared_b",3*nreals*sizeof(Real));
+  bm.request_bytes("private_a",sizeof(Real),BM::Private);
+  bm.request_bytes("private_b",(nreals+1)*sizeof(Real),BM::Private);
+  bm.request_bytes("private_c",0,BM::Private);
+  REQUIRE_THROWS (bm.request_bytes("shared_a",sizeof(Real),BM::Private));
+  REQUIRE_THROWS (bm.request_bytes("shared_a",1));
+  bm.allocate();
+  REQUIRE_THROWS (bm.request_bytes("shared_c",sizeof(Real)));
+
+  // Shared clients get the whole shared arena, private ones get their own aligned slice
+  auto sa = bm.get_client_buffer("shared_a");
+  auto sb = bm.get_client_buffer("shared_b");
+  auto pa = bm.get_client_buffer("private_a");
+  auto pb = bm.get_client_buffer("private_b");
+  auto unknown = bm.get_client_buffer("unknown");
+  REQUIRE (sa.get_memory()==sb.get_memory());
+  REQUIRE (sa.get_memory()==unknown.get_memory());
+  REQUIRE (sa.allocated_bytes()==3*nreals*sizeof(Real));
+  REQUIRE (pa.allocated_bytes()==nreals*sizeof(Real));
+  REQUIRE (pb.allocated_bytes()==2*nreals*sizeof(Real));
+  REQUIRE (pa.get_memory()==sa.get_memory()+3*nreals);
+  REQUIRE (pb.get_memory()==pa.get_memory()+nreals);
+  for (const auto& b : {sa,pa,pb}) {
+    REQUIRE (reinterpret_cast<std::uintptr_t>(b.get_memory())%BM::alignment==0);
+  }
+
+  // Poison, write some entries, and check the recorded usage
+  bm.set_poisoning(true);
+  auto write = [](const BM& b, const int n) {
+    Kokkos::View<Real*,DefaultDevice,Kokkos::MemoryUnmanaged> mem(b.get_memory(),n);
+    Kokkos::deep_copy(mem,1);
+  };
+  bm.poison("shared_a");
+  write(sa,12);
+  bm.record_usage("shared_a");
+  bm.poison("private_b");
+  write(pb,nreals);
+  bm.record_usage("private_b");
+
+  // Clients that write nothing, or have no memory at all, used 0 bytes
+  bm.poison("private_a");
+  bm.record_usage("private_a");
+  bm.poison("private_c");
+  bm.record_usage("private_c");
+
+  const auto report = bm.usage_report();
+  auto report_line = [&](const std::string& client) {
+    const auto beg = report.find("  "+client+" ");
+    return report.substr(beg,report.find('\n',beg)-beg);
+  };
+  for (const std::string client : {"private_a","private_c"}) {
+    const auto line = report_line(client);
+    REQUIRE (line.substr(line.size()-2)==" 0");
+  }
+  REQUIRE (report.find(std::to_string(12*sizeof(Real))+"  <-- exceeds request")!=std::string::npos);
+  REQUIRE (report.find("n/a")!=std::string::npos);
+  REQUIRE (report.find(std::to_string(nreals*sizeof(Real))+"\n")!=std::string::npos);
+}
+
 } // empty namespace
@@ -63,6 +63,24 @@ void read_fields (const std::string& filename,
   scorpio::release_file(filename);
 }
 
+// Value of entry k of a slab variable at record irec, linearly interpolated
+// towards record irec+1 with weight w (w==0 means no interpolation)
+template<typename SlabView>
+KOKKOS_INLINE_FUNCTION
+Real slab_value (const SlabView& slab, const int irec, const Real w, const int k)
+{
+  return w==0 ? slab(irec,k) : (1-w)*slab(irec,k) + w*slab(irec+1,k);
+}
+
+// Extract a (possibly time interpolated) record of a slab variable into dst
+template<typename SlabView, typename DstView>
+void extract_slab_record (const SlabView& slab, const int irec, const Real w, const DstView& dst)
+{
+  Kokkos::parallel_for(slab.extent(1), KOKKOS_LAMBDA (const int k) {
+    dst(k) = slab_value(slab, irec, w, k);
+  });
+}
+
 } // anonymous namespace
 
 IOPDataManager::
@@ -100,6 +118,14 @@ IOPDataManager(const ekat::Comm& comm,
   if (not m_params.isParameter("iop_nudge_tq_high"))    m_params.set<Real>("iop_nudge_tq_high",    0);
   if (not m_params.isParameter("iop_nudge_tscale"))     m_params.set<Real>("iop_nudge_tscale",     10800);
   if (not m_params.isParameter("zero_non_iop_tracers")) m_params.set<bool>("zero_non_iop_tracers", false);
+  if (not m_params.isParameter("iop_read_slab_size"))   m_params.set<int>("iop_read_slab_size",     32);
+  if (not m_params.isParameter("iop_time_interpolation")) m_params.set<bool>("iop_time_interpolation", false);
+
+  m_slab_size = m_params.get<int>("iop_read_slab_size");
+  m_time_interpolation = m_params.get<bool>("iop_time_interpolation");
+  EKAT_REQUIRE_MSG(m_slab_size >= 2,
+                   "Error! iop_read_slab_size must be at least 2.\n"
+                   " - iop_read_slab_size: " + std::to_string(m_slab_size) + "\n");
 
   // Store hybrid coords in helper fields
   m_helper_fields.insert({"hyam", hyam});
@@ -341,6 +367,10 @@ initialize_iop_file(const util::TimeStamp& run_t0,
   iop_file_pressure.sync_to_dev();
   m_helper_fields.insert({"iop_file_pressure", iop_file_pressure});
 
+  // Keep a pristine copy of the file levels, since iop_file_pressure is
+  // clipped using the surface pressure at every read
+  m_helper_fields.insert({"iop_file_levels", iop_file_pressure.clone("iop_file_levels")});
+
   // Create model pressure helper field (values will be computed
   // in read_iop_file_data())
   FieldIdentifier model_pres_fid("model_pressure",
@@ -350,6 +380,65 @@ initialize_iop_file(const util::TimeStamp& run_t0,
   model_pressure.get_header().get_alloc_properties().request_allocation(Pack::n);
   model_pressure.allocate_view();
   m_helper_fields.insert({"model_pressure", model_pressure});
+
+  // Register all the file variables that read_iop_file_data needs with the
+  // slab cache, and create the helper fields holding level data on file levels
+  // (the extra entry is for the surface value).
+  add_slab_var("Ps", 1);
+  for (const auto& it : m_iop_fields) {
+    const auto& fname = it.first;
+    if (m_iop_field_type.at(fname)==IOPFieldType::Computed) continue;
+
+    const auto file_varname = (m_iop_file_varnames.count(fname) > 0) ? m_iop_file_varnames[fname] : fname;
+    if (it.second.rank()==0) {
+      add_slab_var(file_varname, 1);
+    } else {
+      add_slab_var(file_varname, file_levs);
+      if (m_iop_field_surface_varnames.count(fname) > 0) {
+        add_slab_var(m_iop_field_surface_varnames[fname], 1);
+      }
+
+      FieldIdentifier file_fid(file_varname+"_iop_file",
+                               FieldLayout({FieldTag::LevelMidPoint}, {file_levs+1}),
+                               ekat::units::none, "");
+      Field iop_file_field(file_fid);
+      iop_file_field.get_header().get_alloc_properties().request_allocation(Pack::n);
+      iop_file_field.allocate_view();
+      m_helper_fields.insert({iop_file_field.name(), iop_file_field});
+    }
+  }
+}
+
+void IOPDataManager::
+add_slab_var (const std::string& file_varname, const int nlevs)
+{
+  if (m_slab.data.count(file_varname) > 0) return;
+
+  const auto iop_file = m_params.get<std::string>("iop_file");
+  const int ntimes = m_time_info.iop_file_times_in_sec.extent(0);
+  const int nrecs = std::min(m_slab_size, ntimes);
+
+  EKAT_REQUIRE_MSG(scorpio::get_var(iop_file, file_varname).time_dep,
+                   "Error! IOP file variable \""+file_varname+"\" is expected to be time dependent.\n");
+
+  m_slab.data[file_varname] = view_2d<Real>("slab_"+file_varname, nrecs, nlevs);
+  m_slab_host[file_varname] = Kokkos::create_mirror_view(m_slab.data[file_varname]);
+}
+
+void IOPDataManager::
+load_slab (const int first_record)
+{
+  const auto iop_file = m_params.get<std::string>("iop_file");
+  const int ntimes = m_time_info.iop_file_times_in_sec.extent(0);
+
+  // Read one block of records per variable, and move it to device all at once
+  m_slab.first_record = first_record;
+  m_slab.num_records = std::min(m_slab_size, ntimes-first_record);
+  for (auto& it : m_slab_host) {
+    scorpio::read_var_records(iop_file, it.first, it.second.data(),
+                              first_record, m_slab.num_records);
+    Kokkos::deep_copy(m_slab.data[it.first], it.second);
+  }
 }
 
 void IOPDataManager::
@@ -426,11 +515,23 @@ read_iop_file_data (const util::TimeStamp& current_ts)
 
   // Query to see if we need to load data from IOP file.
   // If we are still in the time interval as the previous
-  // read from iop file, there is no need to reload data.
+  // read from iop file, there is no need to reload data
+  // (unless we interpolate in time, and the time changed).
   const auto iop_file_time_idx = m_time_info.get_iop_file_time_idx(current_ts);
   EKAT_REQUIRE_MSG(iop_file_time_idx >= m_time_info.time_idx_of_current_data,
                    "Error! Attempting to read previous iop file data time index.\n");
-  if (iop_file_time_idx == m_time_info.time_idx_of_current_data) return;
+  if (iop_file_time_idx == m_time_info.time_idx_of_current_data and
+      (not m_time_interpolation or current_ts == m_time_info.time_of_current_data)) return;
+
+  // Only go to file if the needed records are not already in the slab.
+  const auto last_needed_idx = m_time_interpolation ? iop_file_time_idx+1 : iop_file_time_idx;
+  if (not m_slab.contains(iop_file_time_idx) or not m_slab.contains(last_needed_idx)) {
+    load_slab(iop_file_time_idx);
+  }
+  const int irec = iop_file_time_idx - m_slab.first_record;
+  const Real w = m_time_interpolation
+               ? m_time_info.get_iop_file_time_weight(current_ts, iop_file_time_idx)
+               : 0;
 
   const auto iop_file = m_params.get<std::string>("iop_file");
   const auto file_levs = scorpio::get_dimlen(iop_file, "lev");
@@ -457,22 +558,14 @@ read_iop_file_data (const util::TimeStamp& current_ts)
   int model_start;
   int model_end;
   if (has_level_data) {
-    // Load surface pressure (Ps) from iop file
-    auto ps_data = surface_pressure.get_view<Real, Host>().data();
-
-    scorpio::read_var(iop_file,"Ps",ps_data,iop_file_time_idx);
-    surface_pressure.sync_to_dev();
-
-    // Read in IOP lev data
-    auto data = iop_file_pressure.get_view<Real*, Host>().data();
-    scorpio::read_var(iop_file,"lev",data);
-
-    // Convert to pressure to millibar (file gives pressure in Pa)
-    for (int ilev=0; ilev<file_levs; ++ilev) data[ilev] /= 100;
-    iop_file_pressure.sync_to_dev();
-
-    // Pre-process file pressures, store number of file levels
-    // where the last level is the first level equal to surface pressure.
+    // Get surface pressure (Ps) from the slab
+    extract_slab_record(m_slab.data.at("Ps"), irec, w,
+                        view_1d<Real>(surface_pressure.get_view<Real>().data(), 1));
+
+    // Pre-process file pressures (reset from the file levels, in millibar),
+    // store number of file levels where the last level is the first level
+    // equal to surface pressure.
+    const auto iop_file_levs_v = m_helper_fields["iop_file_levels"].get_view<const Real*>();
     const auto iop_file_pres_v = iop_file_pressure.get_view<Real*>();
     // Sanity check
     EKAT_REQUIRE_MSG(file_levs+1 == iop_file_pressure.get_header().get_identifier().get_layout().dim(0),
@@ -482,6 +575,8 @@ read_iop_file_data (const util::TimeStamp& current_ts)
       if (ilev == file_levs) {
         // Add surface pressure to last iop file pressure entry
         iop_file_pres_v(ilev) = Ps()/100;
+      } else {
+        iop_file_pres_v(ilev) = iop_file_levs_v(ilev);
       }
       if (iop_file_pres_v(ilev) > Ps()/100) {
         // Set upper bound on pressure values
@@ -553,59 +648,52 @@ read_iop_file_data (const util::TimeStamp& current_ts)
     auto file_varname = (m_iop_file_varnames.count(fname) > 0) ? m_iop_file_varnames[fname] : fname;
 
     if (field.rank()==0) {
-      // For scalar data, read iop file variable directly into field data
-      auto data = field.get_view<Real, Host>().data();
-      scorpio::read_var(iop_file,file_varname,data,iop_file_time_idx);
-      field.sync_to_dev();
+      // For scalar data, extract the record directly into field data. Some
+      // consumers read scalars on host, so keep the host copy up to date.
+      extract_slab_record(m_slab.data.at(file_varname), irec, w,
+                          view_1d<Real>(field.get_view<Real>().data(), 1));
+      field.sync_to_host();
     } else if (field.rank()==1) {
-      // Create temporary fields for reading iop file variables. We use
-      // adjusted_file_levels (computed above) which contains an unset
-      // value for surface.
-      FieldIdentifier fid(file_varname+"_iop_file",
-                          FieldLayout({FieldTag::LevelMidPoint},
-                          {adjusted_file_levs}),
-                          ekat::units::none,
-                          "");
-      Field iop_file_field(fid);
-      iop_file_field.get_header().get_alloc_properties().request_allocation(Pack::n);
-      iop_file_field.allocate_view();
-
-      // Read data from iop file.
-      std::vector<Real> data(file_levs);
-      scorpio::read_var(iop_file,file_varname,data.data(),iop_file_time_idx);
-
-      // Copy first adjusted_file_levs-1 values to field
-      auto iop_file_v_h = iop_file_field.get_view<Real*,Host>();
-      for (int ilev=0; ilev<adjusted_file_levs-1; ++ilev) iop_file_v_h(ilev) = data[ilev];
-
-      // Set or compute surface value
+      // Helper field for data on iop file levels. Only the first
+      // adjusted_file_levs (computed above) entries are used, where the
+      // last one contains the surface value.
+      auto iop_file_field = m_helper_fields.at(file_varname+"_iop_file");
+
+      // Copy first adjusted_file_levs-1 values from the slab, then set or
+      // compute surface value
+      const auto record = m_slab.data.at(file_varname);
       const auto has_srf = m_iop_field_surface_varnames.count(fname)>0;
-      if (has_srf) {
-        const auto srf_varname = m_iop_field_surface_varnames[fname];
-        scorpio::read_var(iop_file,srf_varname,&iop_file_v_h(adjusted_file_levs-1),iop_file_time_idx);
-      } else {
-        // No surface value exists, compute surface value
-        const auto dx = iop_file_v_h(adjusted_file_levs-2) - iop_file_v_h(adjusted_file_levs-3);
-        if (dx == 0) iop_file_v_h(adjusted_file_levs-1) = iop_file_v_h(adjusted_file_levs-2);
-        else {
-          iop_file_pressure.sync_to_host();
-          const auto iop_file_pres_v_h = iop_file_pressure.get_view<const Real*, Host>();
-          const auto dy = iop_file_pres_v_h(adjusted_file_levs-2) - iop_file_pres_v_h(adjusted_file_levs-3);
-          const auto scale = dy/dx;
-
-          iop_file_v_h(adjusted_file_levs-1) =
-            (iop_file_pres_v_h(adjusted_file_levs-1)-iop_file_pres_v_h(adjusted_file_levs-2))/scale
-            + iop_file_v_h(adjusted_file_levs-2);
+      const auto srf_record = has_srf ? m_slab.data.at(m_iop_field_surface_varnames[fname])
+                                      : view_2d<Real>();
+      const auto iop_file_pres_v = iop_file_pressure.get_view<const Real*>();
+      const auto iop_file_v = iop_file_field.get_view<Real*>();
+      const auto nlevs = adjusted_file_levs;
+      Kokkos::parallel_for(nlevs, KOKKOS_LAMBDA (const int ilev) {
+        if (ilev < nlevs-1) {
+          iop_file_v(ilev) = slab_value(record, irec, w, ilev);
+        } else if (has_srf) {
+          iop_file_v(ilev) = slab_value(srf_record, irec, w, 0);
+        } else {
+          // No surface value exists, compute surface value
+          const auto v1 = slab_value(record, irec, w, ilev-1);
+          const auto v2 = slab_value(record, irec, w, ilev-2);
+          const auto dx = v1 - v2;
+          if (dx == 0) iop_file_v(ilev) = v1;
+          else {
+            const auto dy = iop_file_pres_v(ilev-1) - iop_file_pres_v(ilev-2);
+            const auto scale = dy/dx;
+
+            iop_file_v(ilev) = (iop_file_pres_v(ilev)-iop_file_pres_v(ilev-1))/scale + v1;
+          }
         }
-      }
-      iop_file_field.sync_to_dev();
+      });
 
       // Vertically interpolate iop file data to iop fields.
       // Note: ekat lininterp requires packs. Use 1d packs here
       // to easily mask out levels which we do not want to interpolate.
-      const auto iop_file_pres_v = iop_file_pressure.get_view<const Pack1d*>();
+      const auto iop_file_pres_pack_v = iop_file_pressure.get_view<const Pack1d*>();
       const auto model_pres_v = model_pressure.get_view<const Pack1d*>();
-      const auto iop_file_v = iop_file_field.get_view<const Pack1d*>();
+      const auto iop_file_pack_v = iop_file_field.get_view<const Pack1d*>();
       auto iop_field_v = field.get_view<Pack1d*>();
 
       const auto nlevs_input = iop_file_end - iop_file_start;
@@ -615,9 +703,9 @@ read_iop_file_data (const util::TimeStamp& current_ts)
       ekat::LinInterp<Real,Pack1d::n> vert_interp(1, nlevs_input, nlevs_output);
       const auto policy = TPF::get_default_team_policy(1, total_nlevs);
       Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
-        const auto x_src  = Kokkos::subview(iop_file_pres_v, Kokkos::pair<int,int>(iop_file_start,iop_file_end));
+        const auto x_src  = Kokkos::subview(iop_file_pres_pack_v, Kokkos::pair<int,int>(iop_file_start,iop_file_end));
         const auto x_tgt  = Kokkos::subview(model_pres_v, Kokkos::pair<int,int>(model_start,model_end));
-        const auto input  = Kokkos::subview(iop_file_v, Kokkos::pair<int,int>(iop_file_start,iop_file_end));
+        const auto input  = Kokkos::subview(iop_file_pack_v, Kokkos::pair<int,int>(iop_file_start,iop_file_end));
         const auto output = Kokkos::subview(iop_field_v, Kokkos::pair<int,int>(model_start,model_end));
 
         vert_interp.setup(team, x_src, x_tgt);
@@ -631,11 +719,11 @@ read_iop_file_data (const util::TimeStamp& current_ts)
           fname == "u_ls" || fname == "v" || fname == "v_ls") {
         Kokkos::parallel_for(Kokkos::RangePolicy<>(0, model_start+1),
 			     KOKKOS_LAMBDA (const int ilev) {
-			       iop_field_v(ilev) = iop_file_v(0);
+			       iop_field_v(ilev) = iop_file_pack_v(0);
 			     });
         Kokkos::parallel_for(Kokkos::RangePolicy<>(model_end-1, total_nlevs),
 			     KOKKOS_LAMBDA (const int ilev) {
-			       iop_field_v(ilev) = iop_file_v(adjusted_file_levs-1);
+			       iop_field_v(ilev) = iop_file_pack_v(adjusted_file_levs-1);
 			     });
       }
     }
@@ -667,6 +755,7 @@ read_iop_file_data (const util::TimeStamp& current_ts)
 
   // Now that data is loaded, reset the index of the currently loaded data.
   m_time_info.time_idx_of_current_data = iop_file_time_idx;
+  m_time_info.time_of_current_data = current_ts;
 }
 
 void IOPDataManager::
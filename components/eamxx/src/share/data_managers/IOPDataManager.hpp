@@ -10,6 +10,8 @@
 #include <ekat_parameter_list.hpp>
 #include <ekat_comm.hpp>
 
+#include <algorithm>
+
 namespace scream {
 /*
  * Class which data for an intensive observation period (IOP).
@@ -100,27 +102,52 @@ private:
     view_1d_host<int> iop_file_times_in_sec;
 
     int time_idx_of_current_data = -1;
+    util::TimeStamp time_of_current_data;
 
     int get_iop_file_time_idx (const util::TimeStamp& current_ts)
     {
       // Get iop file time index that the given timestamp falls between.
       // Note: the last time in iop file represents the non-inclusive
       //       upper bound of acceptable model times.
-      const auto n_iop_times = iop_file_times_in_sec.extent(0);
-      int time_idx=-1;
-      for (size_t t=0; t<n_iop_times-1; ++t) {
-        if (iop_file_begin_time + iop_file_times_in_sec(t) <= current_ts &&
-            current_ts < iop_file_begin_time + iop_file_times_in_sec(t+1)) {
-          time_idx = t;
-        }
-      }
-
-      EKAT_REQUIRE_MSG(time_idx>=0,
+      // Note: file times are sorted, so we can bisect, rather than scanning
+      //       all records (which can be many thousands for long IOP files).
+      const int n_iop_times = iop_file_times_in_sec.extent(0);
+      const auto secs = (current_ts - iop_file_begin_time);
+      const auto begin = iop_file_times_in_sec.data();
+      const auto end   = begin + n_iop_times;
+      const int time_idx = current_ts < iop_file_begin_time
+                         ? -1 : std::upper_bound(begin,end,secs) - begin - 1;
+
+      EKAT_REQUIRE_MSG(time_idx>=0 and time_idx<n_iop_times-1,
                        "Error! Current model time ("+current_ts.to_string()+") is not within "
                        "IOP time period: ["+iop_file_begin_time.to_string()+", "+
                        (iop_file_begin_time+iop_file_times_in_sec(n_iop_times-1)).to_string()+").\n");
       return time_idx;
     }
+
+    // Weight of record time_idx+1 when linearly interpolating in time
+    Real get_iop_file_time_weight (const util::TimeStamp& current_ts, const int time_idx) const
+    {
+      const Real t0 = iop_file_times_in_sec(time_idx);
+      const Real t1 = iop_file_times_in_sec(time_idx+1);
+      return ((current_ts - iop_file_begin_time) - t0) / (t1 - t0);
+    }
+  };
+
+  // Device-resident block of consecutive time records of all the variables
+  // we read from the IOP file. Each read_iop_file_data call extracts the
+  // data it needs from here, and only goes to file once we step past the
+  // last record in the block.
+  struct Slab {
+    int first_record = -1;
+    int num_records  = 0;
+
+    // Stored as (record, lev). Scalar vars have a single level.
+    std::map<std::string,view_2d<Real>> data;
+
+    bool contains (const int t) const {
+      return first_record>=0 and first_record<=t and t<first_record+num_records;
+    }
   };
 
   enum IOPFieldType {
@@ -131,11 +158,22 @@ private:
   void initialize_iop_file(const util::TimeStamp& run_t0,
                            int model_nlevs);
 
+  // Allocate the slab storage for a variable in the IOP file
+  void add_slab_var (const std::string& file_varname, const int nlevs);
+
+  // Read a block of time records, starting at first_record, for all slab vars
+  void load_slab (const int first_record);
+
   ekat::Comm m_comm;
   ekat::ParameterList m_params;
 
   TimeInfo m_time_info;
 
+  Slab m_slab;
+  std::map<std::string,view_2d<Real>::HostMirror> m_slab_host;
+  int  m_slab_size;
+  bool m_time_interpolation;
+
   Real m_dynamics_dx_size;
 
   std::map<std::string,grid_ptr> m_io_grids;
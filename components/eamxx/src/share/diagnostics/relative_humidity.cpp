@@ -11,7 +11,18 @@ RelativeHumidityDiagnostic::
 RelativeHumidityDiagnostic (const ekat::Comm& comm, const ekat::ParameterList& params)
  : AtmosphereDiagnostic(comm,params)
 {
-  // Nothing to do here
+  const auto svp_fcn = m_params.get<std::string>("saturation_fcn","MurphyKoop");
+  EKAT_REQUIRE_MSG (svp_fcn=="MurphyKoop" or svp_fcn=="MurphyKoopTable",
+      "Error! Invalid saturation_fcn for RelativeHumidity diagnostic.\n"
+      "  - saturation_fcn: " + svp_fcn + "\n"
+      "  - valid options : MurphyKoop, MurphyKoopTable\n");
+
+  if (svp_fcn=="MurphyKoopTable") {
+    m_svp_fcn = PF::MurphyKoopTable;
+    m_svp_table = PF::create_svp_table();
+  } else {
+    m_svp_fcn = PF::MurphyKoop;
+  }
 }
 
 void RelativeHumidityDiagnostic::create_requests()
@@ -54,9 +65,11 @@ void RelativeHumidityDiagnostic::compute_diagnostic_impl()
   auto qv_mid    = get_field_in("qv").get_view<const Pack**>();
   const auto& RH = m_diagnostic_output.get_view<Pack**>();
 
-  using physics = scream::physics::Functions<Real, DefaultDevice>;
+  using physics = PF;
 
   Int num_levs = m_num_levs;
+  const bool use_table = m_svp_fcn==PF::MurphyKoopTable;
+  const auto svp_table = m_svp_table;
   Kokkos::parallel_for("RelativeHumidityDiagnostic",
                        Kokkos::RangePolicy<>(0,m_num_cols*npacks),
                        KOKKOS_LAMBDA (const int& idx) {
@@ -64,8 +77,11 @@ void RelativeHumidityDiagnostic::compute_diagnostic_impl()
       const int jpack = idx % npacks;
       const auto range_pack = ekat::range<Pack>(jpack*Pack::n);
       const auto range_mask = range_pack < num_levs;
-      auto qv_sat_l = physics::qv_sat_wet(T_mid(icol,jpack),  p_dry_mid(icol,jpack), true, range_mask, dp_wet(icol,jpack), dp_dry(icol,jpack),
-                                           physics::MurphyKoop, "RelativeHumidityDiagnostic::compute_diagnostic_impl"); 
+      const auto qv_sat_l = use_table
+        ? physics::qv_sat_wet(T_mid(icol,jpack),  p_dry_mid(icol,jpack), true, range_mask, dp_wet(icol,jpack), dp_dry(icol,jpack),
+                              svp_table, "RelativeHumidityDiagnostic::compute_diagnostic_impl")
+        : physics::qv_sat_wet(T_mid(icol,jpack),  p_dry_mid(icol,jpack), true, range_mask, dp_wet(icol,jpack), dp_dry(icol,jpack),
+                              physics::MurphyKoop, "RelativeHumidityDiagnostic::compute_diagnostic_impl");
       RH(icol,jpack) = qv_mid(icol,jpack)/qv_sat_l;
 
   });
@@ -2,12 +2,15 @@
 #define EAMXX_RELATIVE_HUMIDITY_DIAGNOSTIC_HPP
 
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/physics/physics_functions.hpp"
 
 namespace scream
 {
 
 class RelativeHumidityDiagnostic : public AtmosphereDiagnostic
 {
+  using PF = physics::Functions<Real, DefaultDevice>;
+
 public:
   // Constructors
   RelativeHumidityDiagnostic (const ekat::Comm& comm, const ekat::ParameterList& params);
@@ -29,6 +32,10 @@ protected:
   Int m_num_cols;
   Int m_num_levs;
 
+  // Saturation vapor pressure: MurphyKoop (default) or MurphyKoopTable
+  PF::SaturationFcn m_svp_fcn;
+  PF::SvpTable      m_svp_table;
+
 }; // class RelativeHumidityDiagnostic
 
 } //namespace scream
@@ -40,7 +40,7 @@ create_gm (const ekat::Comm& comm, const int ncols, const int nlevs) {
 
 //-----------------------------------------------------------------------------------------------//
 template<typename DeviceT>
-void run(std::mt19937_64& engine)
+void run(std::mt19937_64& engine, const bool use_svp_table)
 {
   using PC         = scream::physics::Constants<Real>;
   using Pack       = ekat::Pack<Real,SCREAM_PACK_SIZE>;
@@ -88,6 +88,9 @@ void run(std::mt19937_64& engine)
 
   // Construct the Diagnostic
   ekat::ParameterList params;
+  if (use_svp_table) {
+    params.set<std::string>("saturation_fcn","MurphyKoopTable");
+  }
   register_diagnostics();
   auto& diag_factory = AtmosphereDiagnosticFactory::instance();
   auto diag = diag_factory.create("RelativeHumidity",comm,params);
@@ -160,6 +163,7 @@ void run(std::mt19937_64& engine)
     using physics = scream::physics::Functions<Real, DefaultDevice>;
     using Mask = ekat::Mask<Pack::n>;
     Mask range_mask(true);
+    const auto svp_table = physics::create_svp_table();
     Kokkos::parallel_for("", policy, KOKKOS_LAMBDA(const MemberType& team) {
       const int icol = team.league_rank();
 
@@ -169,7 +173,9 @@ void run(std::mt19937_64& engine)
 
       Kokkos::parallel_for(Kokkos::TeamVectorRange(team,num_mid_packs), [&] (const Int& jpack) {
         dpdry_sub(jpack) = dpwet_sub(jpack) - dpwet_sub(jpack)*qv_sub(jpack);
-        auto qv_sat_l = physics::qv_sat_dry(T_mid_v(icol,jpack), p_dry_mid_v(icol,jpack), true, range_mask);
+        auto qv_sat_l = use_svp_table
+          ? physics::qv_sat_dry(T_mid_v(icol,jpack), p_dry_mid_v(icol,jpack), true, range_mask, svp_table)
+          : physics::qv_sat_dry(T_mid_v(icol,jpack), p_dry_mid_v(icol,jpack), true, range_mask);
         qv_sat_l *=  dpdry_v(icol,jpack) ;
         qv_sat_l /=  dpwet_v(icol,jpack) ;
         rh_v(icol,jpack) = qv_v(icol,jpack)/qv_sat_l;
@@ -208,7 +214,13 @@ TEST_CASE("relative_humidity_test", "relative_humidity_test]"){
 
   printf(" -> Testing Pack<Real,%d> scalar type...",SCREAM_PACK_SIZE);
   for (int irun=0; irun<num_runs; ++irun) {
-    run<Device>(engine);
+    run<Device>(engine,false);
+  }
+  printf("ok!\n");
+
+  printf(" -> Testing Pack<Real,%d> scalar type with tabulated svp...",SCREAM_PACK_SIZE);
+  for (int irun=0; irun<num_runs; ++irun) {
+    run<Device>(engine,true);
   }
   printf("ok!\n");
 
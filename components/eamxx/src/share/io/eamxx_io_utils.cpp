@@ -1,13 +1,19 @@
 #include "share/io/eamxx_io_utils.hpp"
 
+#include "share/io/scorpio_input.hpp"
 #include "share/scorpio_interface/eamxx_scorpio_interface.hpp"
+#include "share/grid/grid_import_export.hpp"
+#include "share/grid/point_grid.hpp"
 #include "share/data_managers/library_grids_manager.hpp"
 #include "share/util/eamxx_utils.hpp"
 #include "share/core/eamxx_config.hpp"
 
 #include <ekat_string_utils.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
+#include <numeric>
 #include <regex>
 
 namespace scream {
@@ -121,6 +127,142 @@ util::TimeStamp read_timestamp (const std::string& filename,
   return ts;
 }
 
+bool file_is_readable (const std::string& filename, const ekat::Comm& comm)
+{
+  int readable = 0;
+  if (comm.am_i_root()) {
+    readable = std::ifstream(filename).good();
+  }
+  comm.broadcast(&readable,1,comm.root_rank());
+  return readable==1;
+}
+
+std::map<std::string,std::vector<Field>>
+group_restart_fields_by_data_file (const std::string& filename,
+                                   const std::vector<Field>& fields,
+                                   const ekat::Comm& comm)
+{
+  std::map<std::string,std::vector<Field>> fields_per_file;
+  for (const auto& f : fields) {
+    const auto att_name = "data_file_for_" + f.name();
+    if (scorpio::has_attribute(filename,"GLOBAL",att_name)) {
+      const auto data_file = scorpio::get_attribute<std::string>(filename,"GLOBAL",att_name);
+      fields_per_file[data_file].push_back(f);
+    } else {
+      fields_per_file[filename].push_back(f);
+    }
+  }
+
+  for (const auto& [data_file,file_fields] : fields_per_file) {
+    if (data_file==filename) {
+      continue;
+    }
+    std::vector<std::string> names;
+    for (const auto& f : file_fields) {
+      names.push_back(f.name());
+    }
+    EKAT_REQUIRE_MSG (file_is_readable(data_file,comm),
+        "Error! The model restart file references an older restart file, which cannot be read.\n"
+        " - restart file   : " + filename + "\n"
+        " - referenced file: " + data_file + "\n"
+        " - fields         : " + ekat::join(names,", ") + "\n"
+        " The restart file was written with scorpio::model_restart::incremental=true, so the\n"
+        " data of these fields is only stored in the referenced file. Copy that file back in the\n"
+        " run directory (e.g., from the short term archive) before restarting.\n");
+  }
+
+  return fields_per_file;
+}
+
+void read_fields_on_rank_subset (const std::string& filename,
+                                 const std::vector<Field>& fields,
+                                 const std::shared_ptr<const AbstractGrid>& grid,
+                                 const int num_readers)
+{
+  using namespace ShortFieldTagsNames;
+  using gid_type = AbstractGrid::gid_type;
+
+  if (fields.size()==0) {
+    return;
+  }
+
+  const auto& comm = grid->get_comm();
+  bool cols_first = grid->type()==GridType::Point;
+  for (const auto& f : fields) {
+    const auto& layout = f.get_header().get_identifier().get_layout();
+    cols_first &= layout.rank()>0 and layout.tag(0)==COL;
+  }
+  if (num_readers<=0 or num_readers>=comm.size() or not cols_first) {
+    AtmosphereInput(filename,grid,fields).read_variables();
+    return;
+  }
+
+  // Reader k sits on rank k*nranks/num_readers, so that readers are spread across
+  // nodes, and reads the k-th of num_readers contiguous chunks of the global columns
+  const std::int64_t nranks = comm.size();
+  const std::int64_t ngcols = grid->get_num_global_dofs();
+  const auto min_gid = grid->get_global_min_dof_gid();
+  int ncols = 0;
+  gid_type first_gid = 0;
+  for (std::int64_t k=0; k<num_readers; ++k) {
+    if (k*nranks/num_readers==comm.rank()) {
+      first_gid = min_gid + k*ngcols/num_readers;
+      ncols = (k+1)*ngcols/num_readers - k*ngcols/num_readers;
+    }
+  }
+
+  auto reader_grid = std::make_shared<PointGrid>(grid->name(),ncols,grid->get_num_vertical_levels(),comm);
+  auto reader_gids = reader_grid->get_dofs_gids();
+  auto reader_gids_h = reader_gids.get_view<gid_type*,Host>();
+  std::iota(reader_gids_h.data(),reader_gids_h.data()+ncols,first_gid);
+  reader_gids.sync_to_dev();
+
+  // Read in fields without padding on the reader grid. The file dims names must match the
+  // ones of the input grid, and each column of a field is a contiguous chunk of col_bytes
+  std::vector<Field> reader_fields;
+  std::vector<int> col_bytes;
+  for (const auto& f : fields) {
+    const auto& fid = f.get_header().get_identifier();
+    auto layout = fid.get_layout().clone();
+    for (auto t : layout.tags()) {
+      if (grid->has_special_tag_name(t)) {
+        reader_grid->reset_field_tag_name(t,grid->get_special_tag_name(t));
+      }
+    }
+    layout.reset_dim(0,ncols);
+    auto& rf = reader_fields.emplace_back(FieldIdentifier(f.name(),layout,fid.get_units(),reader_grid->name(),fid.data_type()));
+    rf.allocate_view();
+    col_bytes.push_back(layout.clone().strip_dim(0).size()*get_type_size(fid.data_type()));
+  }
+  AtmosphereInput(filename,reader_grid,reader_fields).read_variables();
+
+  // Pack the data of all fields for each column, and send it to the column owner
+  std::map<int,std::vector<char>> src, dst;
+  for (int icol=0; icol<ncols; ++icol) {
+    auto& bytes = src[icol];
+    for (size_t i=0; i<reader_fields.size(); ++i) {
+      const auto data = reader_fields[i].get_internal_view_data<const char,Host>() + icol*col_bytes[i];
+      bytes.insert(bytes.end(),data,data+col_bytes[i]);
+    }
+  }
+  GridImportExport imp_exp(reader_grid,grid);
+  imp_exp.scatter(MPI_CHAR,src,dst);
+
+  // Unpack in temporaries without padding, and copy into the (possibly padded or sub) fields
+  const int nlcols = grid->get_num_local_dofs();
+  for (size_t i=0, offset=0; i<fields.size(); offset+=col_bytes[i], ++i) {
+    Field tmp(fields[i].get_header().get_identifier(),true);
+    auto data = tmp.get_internal_view_data<char,Host>();
+    for (int icol=0; icol<nlcols; ++icol) {
+      const auto& bytes = dst.at(icol);
+      std::copy(bytes.data()+offset,bytes.data()+offset+col_bytes[i],data+icol*col_bytes[i]);
+    }
+    tmp.sync_to_dev();
+    auto f = fields[i];
+    f.deep_copy(tmp);
+  }
+}
+
 std::pair<util::TimeStamp,int>
 parse_cf_time_units (const std::string& units_str,
                      const std::string& filename)
@@ -9,9 +9,11 @@
 #include <ekat_string_utils.hpp>
 #include <ekat_comm.hpp>
 
+#include <map>
 #include <string>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace scream
 {
@@ -84,6 +86,30 @@ util::TimeStamp read_timestamp (const std::string& filename,
                                 const std::string& ts_name,
                                 const bool read_nsteps = false);
 
+// Check on the root rank whether a file can be opened, and broadcast the answer
+bool file_is_readable (const std::string& filename, const ekat::Comm& comm);
+
+// Model restart files written with incremental=true do not contain the fields
+// that did not change since an older restart file. Instead, they store the name
+// of that file in the global attribute data_file_for_<field>. Group the fields
+// by the file holding their data, and check that all such files are readable.
+// NOTE: the model restart file must already be registered with scorpio.
+std::map<std::string,std::vector<Field>>
+group_restart_fields_by_data_file (const std::string& filename,
+                                   const std::vector<Field>& fields,
+                                   const ekat::Comm& comm);
+
+// Read fields from file on only num_readers of the ranks of the grid comm, each one
+// reading a contiguous chunk of columns, and send each column to the rank owning it in
+// the grid, in one batched message per pair of ranks. This limits the number of ranks
+// touching the file system when restarting on many ranks.
+// Fields on grids other than point grids, or without COL as first dimension, as well as
+// num_readers<=0 or num_readers>=comm.size(), fall back to reading on all ranks.
+void read_fields_on_rank_subset (const std::string& filename,
+                                 const std::vector<Field>& fields,
+                                 const std::shared_ptr<const AbstractGrid>& grid,
+                                 const int num_readers);
+
 // Parse a CF-compliant time units string of the form "<unit> since <date> [<time>]"
 // and return the reference TimeStamp and multiplier (in seconds) for the given unit.
 // Supported units: seconds, minutes, hours, days.
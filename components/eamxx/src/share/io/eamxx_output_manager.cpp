@@ -709,7 +709,17 @@ setup_internals (const std::shared_ptr<fm_type>& field_mgr,
 
     // Hard code some parameters in case we access them later
     m_params.set<std::string>("floating_point_precision","real");
+
+    // Restart files must allow a bfb restart, so only lossless compression is allowed
+    EKAT_REQUIRE_MSG (m_params.sublist("compression").get<int>("significant_digits",0)==0,
+        "Error! Model restart output does not support lossy compression (significant_digits>0).\n");
   } else {
+    // Referencing data from previous files is only safe for model restart files,
+    // which are read back only by the model, and never appended to
+    EKAT_REQUIRE_MSG (not m_params.get<bool>("incremental",false),
+        "Error! Incremental writes are only supported for model restart output.\n"
+        " - stream name: " + m_params.name() + "\n");
+
     auto avg_type = m_params.get<std::string>("averaging_type");
     m_avg_type = str2avg(avg_type);
     EKAT_REQUIRE_MSG (m_avg_type!=OutputAvgType::Invalid,
@@ -884,8 +894,9 @@ setup_file (      IOFileSpecs& filespecs,
   }
 
   // Make all output streams register their dims/vars
+  // Checkpoints must allow a bfb restart, so they can only use lossless compression
   for (auto& it : m_output_streams) {
-    it->setup_output_file(filename,fp_precision,mode);
+    it->setup_output_file(filename,fp_precision,mode,not is_checkpoint_step);
   }
 
   // If grid data is needed,  also register geo data fields. Skip if file is resumed,
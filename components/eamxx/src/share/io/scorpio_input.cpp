@@ -235,11 +235,15 @@ void AtmosphereInput::read_variables (const int time_index)
             " - field name: " + name + "\n");
     }
 
-    f_scorpio.sync_to_dev();
+    // Do not fence: the upload (and copy to the user field) can proceed on device
+    // while we read the next field from file. All device work is ordered on the
+    // default execution space instance, so a single fence at the end is enough.
+    f_scorpio.sync_to_dev(false);
     if (not f_scorpio.is_aliasing(f_user)) {
       f_user.deep_copy(f_scorpio);
     }
   }
+  Kokkos::fence();
   if (m_atm_logger) {
     auto func_finish = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start)/1000.0;
@@ -112,6 +112,25 @@ AtmosphereOutput::AtmosphereOutput(const ekat::Comm &comm, const ekat::Parameter
     m_transpose = params.get<bool>("transpose");
   }
 
+  // Compression/quantization settings: stream defaults, plus optional per-field overrides
+  if (params.isSublist("compression")) {
+    auto parse_compression = [](const ekat::ParameterList& pl, const scorpio::VarCompression& dflt) {
+      scorpio::VarCompression c;
+      c.deflate_level      = pl.get<int>("deflate_level",dflt.deflate_level);
+      c.shuffle            = pl.get<bool>("shuffle",dflt.shuffle);
+      c.significant_digits = pl.get<int>("significant_digits",dflt.significant_digits);
+      return c;
+    };
+    const auto& c_pl = params.sublist("compression");
+    m_compression = parse_compression(c_pl,scorpio::VarCompression());
+    if (c_pl.isSublist("fields")) {
+      const auto& f_pl = c_pl.sublist("fields");
+      for (const auto& fname : f_pl.sublist_names()) {
+        m_field_compression[fname] = parse_compression(f_pl.sublist(fname),m_compression);
+      }
+    }
+  }
+
   auto gm = field_mgr->get_grids_manager();
 
   // Figure out what kind of averaging is requested
@@ -121,6 +140,18 @@ AtmosphereOutput::AtmosphereOutput(const ekat::Comm &comm, const ekat::Parameter
       "Error! Unsupported averaging type '" + avg_type + "'.\n"
       "       Valid options: instant, Max, Min, Average. Case insensitive.\n");
 
+  // Incremental writes: fields that did not change since the last write are not rewritten
+  m_incremental = params.get<bool>("incremental",false);
+  m_full_write_frequency = params.get<int>("full_write_frequency",0);
+  EKAT_REQUIRE_MSG (not m_incremental or m_avg_type==OutputAvgType::Instant,
+      "Error! Incremental writes are only supported for instant output.\n"
+      " - stream name: " + m_stream_name + "\n"
+      " - averaging type: " + avg_type + "\n");
+  EKAT_REQUIRE_MSG (m_full_write_frequency>=0,
+      "Error! Invalid value for full_write_frequency (must be non-negative).\n"
+      " - stream name: " + m_stream_name + "\n"
+      " - full_write_frequency: " + std::to_string(m_full_write_frequency) + "\n");
+
   // By default, IO is done directly on the field mgr grid
   auto fm_grid = field_mgr->get_grids_manager()->get_grid(grid_name);
 
@@ -592,6 +623,11 @@ run (const std::string& filename,
   // Take care of updating and possibly writing fields.
   for (size_t i = 0; i < m_fields_names.size(); ++i) {
     const auto& field_name = m_fields_names[i];
+
+    // Unchanged since the last write, and referenced from the file holding its data
+    if (is_write_step and m_skipped_fields.count(field_name)==1) {
+      continue;
+    }
     
     // Get all the info for this field.
     const auto& f_in  = fm_after_hr->get_field(field_name);
@@ -656,10 +692,20 @@ run (const std::string& filename,
       auto func_finish = std::chrono::steady_clock::now();
       auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
       duration_write += duration_loc.count();
+
+      if (m_incremental) {
+        m_last_write_file[field_name] = filename;
+        const auto& f_model = m_field_mgrs[FromModel]->get_field(field_name);
+        m_last_write_ts[field_name] = f_model.get_header().get_tracking().get_time_stamp();
+      }
     }
   }
 
   if (is_write_step) {
+    if (m_skipped_fields.size()>0) {
+      m_atm_logger->info("  Skipped " + std::to_string(m_skipped_fields.size()) + " unchanged fields"
+                         " (incremental write)");
+    }
     m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
   }
 } // run
@@ -773,7 +819,8 @@ reset_scorpio_fields()
 void AtmosphereOutput::
 register_variables(const std::string& filename,
                    const std::string& fp_precision,
-                   const scorpio::FileMode mode)
+                   const scorpio::FileMode mode,
+                   const bool allow_lossy_compression)
 {
   using namespace ShortFieldTagsNames;
 
@@ -784,6 +831,12 @@ register_variables(const std::string& filename,
 
   // Cycle through all fields and register variables
   for (const auto& field_name : m_fields_names) {
+    if (m_skipped_fields.count(field_name)==1) {
+      // Not written to this file: store where the data can be found instead
+      scorpio::set_attribute(filename,"GLOBAL","data_file_for_"+field_name,m_last_write_file.at(field_name));
+      continue;
+    }
+
     const auto& f = m_field_mgrs[Scorpio]->get_field(field_name);
     const auto& fid  = f.get_header().get_identifier();
     const auto& dimnames = m_vars_dims.at(field_name);
@@ -819,8 +872,13 @@ register_variables(const std::string& filename,
           "  - var time dep: " + (m_add_time_dim ? "yes" : "no") + "\n"
           "  - var time dep from file: " + (var.time_dep ? "yes" : "no") + "\n");
     } else {
+      auto compression = m_field_compression.count(field_name)==1
+                       ? m_field_compression.at(field_name) : m_compression;
+      if (not allow_lossy_compression) {
+        compression.significant_digits = 0;
+      }
       scorpio::define_var (filename, field_name, units, dimnames,
-                            "real",fp_precision, m_add_time_dim);
+                            "real",fp_precision, m_add_time_dim, compression);
 
       // Add FillValue as an attribute of each variable
       // FillValue is a protected metadata, do not add it if it already existed
@@ -973,7 +1031,8 @@ void AtmosphereOutput::set_decompositions(const std::string& filename)
 void AtmosphereOutput::
 setup_output_file(const std::string& filename,
                   const std::string& fp_precision,
-                  const scorpio::FileMode mode)
+                  const scorpio::FileMode mode,
+                  const bool allow_lossy_compression)
 {
   // Register dimensions with netCDF file.
   for (const auto& [dimname,dimlen] : m_dims_len) {
@@ -994,8 +1053,33 @@ setup_output_file(const std::string& filename,
     }
   }
 
+  // For incremental writes, find fields that did not change since they were last written.
+  // Every full_write_frequency files (if positive), we write all fields anyways, so that
+  // old files are no longer referenced. We also write the fields whose last file can no
+  // longer be read (e.g., it was moved to the archive), since a restart would fail.
+  m_skipped_fields.clear();
+  const bool full_write = m_full_write_frequency>0 and m_num_files_setup%m_full_write_frequency==0;
+  if (m_incremental and mode==scorpio::FileMode::Write and not full_write) {
+    strmap_t<bool> readable;
+    for (const auto& [fname,ts] : m_last_write_ts) {
+      const auto& f = m_field_mgrs[FromModel]->get_field(fname);
+      const auto& f_ts = f.get_header().get_tracking().get_time_stamp();
+      if (not f_ts.is_valid() or f_ts!=ts) {
+        continue;
+      }
+      const auto& data_file = m_last_write_file.at(fname);
+      if (readable.count(data_file)==0) {
+        readable[data_file] = file_is_readable(data_file,m_comm);
+      }
+      if (readable.at(data_file)) {
+        m_skipped_fields.insert(fname);
+      }
+    }
+  }
+  ++m_num_files_setup;
+
   // Register variables with netCDF file.  Must come after dimensions are registered.
-  register_variables(filename,fp_precision,mode);
+  register_variables(filename,fp_precision,mode,allow_lossy_compression);
 
   // Set the offsets of the local dofs in the global vector.
   set_decompositions(filename);
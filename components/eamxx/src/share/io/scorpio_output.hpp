@@ -13,6 +13,8 @@
 #include <ekat_comm.hpp>
 #include <ekat_parameter_list.hpp>
 
+#include <set>
+
 /*  The AtmosphereOutput class handles an output stream in SCREAM.
  *  Typical usage is to register an AtmosphereOutput object with the OutputManager (see
  eamxx_output_manager.hpp
@@ -141,8 +143,9 @@ public:
   void restart(const std::string &filename);
   void init();
   void reset_scorpio_fields();
+  // If allow_lossy_compression=false (e.g., for checkpoints), quantization is disabled
   void setup_output_file(const std::string &filename, const std::string &fp_precision,
-                         const scorpio::FileMode mode);
+                         const scorpio::FileMode mode, const bool allow_lossy_compression = true);
 
   void init_timestep(const util::TimeStamp &start_of_step);
   void run(const std::string &filename, const bool output_step, const bool checkpoint_step,
@@ -171,7 +174,7 @@ protected:
 
   // Internal functions
   void register_variables(const std::string &filename, const std::string &fp_precision,
-                          const scorpio::FileMode mode);
+                          const scorpio::FileMode mode, const bool allow_lossy_compression);
   void set_decompositions(const std::string &filename);
   void compute_diagnostics(const bool allow_invalid_fields);
   void process_requested_fields();
@@ -245,6 +248,19 @@ protected:
 
   DefaultMetadata m_default_metadata;
 
+  // Compression/quantization of output vars (stream default, and per-field overrides)
+  scorpio::VarCompression m_compression;
+  strmap_t<scorpio::VarCompression> m_field_compression;
+
+  // Incremental writes: a field whose time stamp did not change since it was last written is
+  // not written again. Instead, the new file stores the name of the file holding its data.
+  bool m_incremental          = false;
+  int  m_full_write_frequency = 0;  // If >0, write all fields in every N-th file
+  int  m_num_files_setup      = 0;
+  strmap_t<std::string>     m_last_write_file;
+  strmap_t<util::TimeStamp> m_last_write_ts;
+  std::set<std::string>     m_skipped_fields;   // Fields not written in the current file
+
   bool m_add_time_dim;
   bool m_track_avg_cnt         = false;
   bool m_latlon_output = false;
@@ -0,0 +1,143 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/eamxx_output_manager.hpp"
+#include "share/io/eamxx_io_utils.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/scorpio_interface/eamxx_scorpio_interface.hpp"
+
+#include "share/data_managers/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/data_managers/field_manager.hpp"
+
+#include "share/core/eamxx_setup_random_test.hpp"
+#include "share/util/eamxx_time_stamp.hpp"
+#include "share/core/eamxx_types.hpp"
+
+#include <ekat_units.hpp>
+#include <ekat_parameter_list.hpp>
+#include <ekat_comm.hpp>
+
+#include <cstdio>
+#include <memory>
+
+namespace scream {
+
+TEST_CASE("io_incremental_restart","io")
+{
+  using namespace ShortFieldTagsNames;
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  int seed = get_random_test_seed(&comm);
+
+  // For 2+ ranks tests, this will check IO works correctly
+  // even if one rank owns 0 dofs
+  const int ngcols = std::max(comm.size()-1,1);
+  const int nlevs  = 4;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  auto grid = gm->get_grid("point_grid");
+  const int nlcols = grid->get_num_local_dofs();
+
+  const util::TimeStamp t0 ({2000,1,1},{0,0,0});
+  const int dt = 1;
+
+  // A field updated at every step, and one that is never updated
+  Field dyn (FID("dyn", FL({COL,LEV},{nlcols,nlevs}), ekat::units::none, grid->name()));
+  Field stat(FID("stat",FL({COL    },{nlcols      }), ekat::units::none, grid->name()));
+  auto fm = std::make_shared<FieldManager>(grid);
+  for (auto f : {dyn,stat}) {
+    f.allocate_view();
+    randomize_uniform(f,seed++);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+    fm->add_to_group(f.name(),"RESTART");
+  }
+  dyn  = fm->get_field("dyn");
+  stat = fm->get_field("stat");
+
+  ekat::ParameterList params;
+  const std::string prefix = "io_incremental_restart";
+  params.set("filename_prefix",prefix);
+  params.set("incremental",true);
+  params.sublist("output_control").set<std::string>("frequency_units","nsteps");
+  params.sublist("output_control").set("frequency",1);
+
+  OutputManager om;
+  om.initialize(comm,params,t0,true);
+  om.setup(fm,gm->get_grid_names());
+
+  // Write one restart file per step
+  std::vector<std::string> files;
+  std::vector<Field> dyn_values;
+  auto step = [&](util::TimeStamp& t) {
+    om.init_timestep(t,dt);
+    t += dt;
+    randomize_uniform(dyn,seed++);
+    dyn.get_header().get_tracking().update_time_stamp(t);
+    om.run(t);
+    files.push_back(find_filename_in_rpointer(prefix,true,comm,t));
+    dyn_values.push_back(dyn.clone());
+  };
+
+  auto t = t0;
+  step(t);
+  step(t);
+
+  // The first file is self-contained, while the second one only references stat
+  for (const auto& fn : files) {
+    scorpio::register_file(fn,scorpio::Read);
+  }
+  REQUIRE (scorpio::has_var(files[0],"stat"));
+  REQUIRE (scorpio::has_var(files[1],"dyn"));
+  REQUIRE (not scorpio::has_var(files[1],"stat"));
+  REQUIRE (scorpio::get_attribute<std::string>(files[1],"GLOBAL","data_file_for_stat")==files[0]);
+
+  // Restart from the second file, reading stat from the first one
+  const auto fields_per_file = group_restart_fields_by_data_file(files[1],{dyn,stat},comm);
+  REQUIRE (fields_per_file.size()==2);
+  REQUIRE (fields_per_file.at(files[0]).size()==1);
+  REQUIRE (fields_per_file.at(files[1]).size()==1);
+  REQUIRE (fields_per_file.at(files[0])[0].name()=="stat");
+  REQUIRE (fields_per_file.at(files[1])[0].name()=="dyn");
+
+  auto dyn_read  = dyn.clone();
+  auto stat_read = stat.clone();
+  dyn_read.deep_copy(0);
+  stat_read.deep_copy(0);
+  AtmosphereInput(files[1],grid,{dyn_read}).read_variables();
+  AtmosphereInput(files[0],grid,{stat_read}).read_variables();
+  REQUIRE (views_are_equal(dyn_read,dyn_values[1],&comm));
+  REQUIRE (views_are_equal(stat_read,stat,&comm));
+
+  for (const auto& fn : files) {
+    scorpio::release_file(fn);
+  }
+
+  // If the referenced file is gone, restarting fails with a clear error,
+  // while the next restart file writes stat again
+  if (comm.am_i_root()) {
+    std::remove(files[0].c_str());
+  }
+  comm.barrier();
+
+  scorpio::register_file(files[1],scorpio::Read);
+  REQUIRE_THROWS (group_restart_fields_by_data_file(files[1],{dyn,stat},comm));
+  scorpio::release_file(files[1]);
+
+  step(t);
+  scorpio::register_file(files[2],scorpio::Read);
+  REQUIRE (scorpio::has_var(files[2],"stat"));
+  REQUIRE (not scorpio::has_attribute(files[2],"GLOBAL","data_file_for_stat"));
+  scorpio::release_file(files[2]);
+
+  om.finalize();
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
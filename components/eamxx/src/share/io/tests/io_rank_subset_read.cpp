@@ -0,0 +1,94 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/eamxx_output_manager.hpp"
+#include "share/io/eamxx_io_utils.hpp"
+#include "share/scorpio_interface/eamxx_scorpio_interface.hpp"
+
+#include "share/data_managers/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/data_managers/field_manager.hpp"
+
+#include "share/core/eamxx_setup_random_test.hpp"
+#include "share/util/eamxx_time_stamp.hpp"
+#include "share/core/eamxx_types.hpp"
+
+#include <ekat_units.hpp>
+#include <ekat_parameter_list.hpp>
+#include <ekat_comm.hpp>
+
+#include <memory>
+
+namespace scream {
+
+TEST_CASE("io_rank_subset_read","io")
+{
+  using namespace ShortFieldTagsNames;
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  int seed = get_random_test_seed(&comm);
+
+  // Column counts not divisible by the number of readers
+  const int ngcols = 3*comm.size()+1;
+  const int nlevs  = 4;
+  const int ncmps  = 2;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  auto grid = gm->get_grid("point_grid");
+  const int nlcols = grid->get_num_local_dofs();
+
+  const util::TimeStamp t0 ({2000,1,1},{0,0,0});
+
+  Field f1(FID("f1",FL({COL          },{nlcols            }),ekat::units::none,grid->name()));
+  Field f2(FID("f2",FL({COL,LEV      },{nlcols,nlevs      }),ekat::units::none,grid->name()));
+  Field f3(FID("f3",FL({COL,CMP,ILEV},{nlcols,ncmps,nlevs+1}),ekat::units::none,grid->name()));
+  auto fm = std::make_shared<FieldManager>(grid);
+  std::vector<Field> fields;
+  for (auto f : {f1,f2,f3}) {
+    f.allocate_view();
+    randomize_uniform(f,seed++);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+    fm->add_to_group(f.name(),"RESTART");
+    fields.push_back(fm->get_field(f.name()));
+  }
+
+  ekat::ParameterList params;
+  const std::string prefix = "io_rank_subset_read";
+  params.set("filename_prefix",prefix);
+  params.sublist("output_control").set<std::string>("frequency_units","nsteps");
+  params.sublist("output_control").set("frequency",1);
+
+  OutputManager om;
+  om.initialize(comm,params,t0,true);
+  om.setup(fm,gm->get_grid_names());
+  auto t = t0;
+  om.init_timestep(t,1);
+  t += 1;
+  om.run(t);
+  om.finalize();
+  const auto filename = find_filename_in_rpointer(prefix,true,comm,t);
+
+  // Any number of readers gives the same fields, including the fallback
+  // to reading on all ranks (num_readers=0 or num_readers>=comm.size())
+  for (int num_readers : {0,1,2,comm.size()}) {
+    std::vector<Field> read;
+    for (const auto& f : fields) {
+      read.push_back(f.clone());
+      read.back().deep_copy(0);
+    }
+    read_fields_on_rank_subset(filename,read,grid,num_readers);
+    for (size_t i=0; i<fields.size(); ++i) {
+      REQUIRE (views_are_equal(read[i],fields[i],&comm));
+    }
+  }
+
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
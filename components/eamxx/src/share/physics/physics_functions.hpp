@@ -24,7 +24,7 @@ template <typename ScalarT, typename DeviceT>
 struct Functions
 {
 
-  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1};
+  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1, MurphyKoopTable = 2};
 
   //
   // ------- Types --------
@@ -59,6 +59,17 @@ struct Functions
 
   using Workspace = typename ekat::WorkspaceManager<Pack, Device>::Workspace;
 
+  // MurphyKoop_svp tabulated on a uniform temperature grid, used by the
+  // MurphyKoopTable saturation function. Build it once with create_svp_table,
+  // and capture it by value in kernels.
+  struct SvpTable {
+    view_1d<const Scalar> liq;  // svp over liquid [Pa]
+    view_1d<const Scalar> ice;  // svp over ice [Pa], continued with the ice formula above Tmelt
+    Scalar t_min  = 0;          // temperature of the first entry [K]
+    Scalar inv_dt = 0;          // inverse of the table spacing [1/K]
+    Int    n      = 0;          // number of entries
+  };
+
   //
   // --------- Functions ---------
   //
@@ -80,6 +91,20 @@ struct Functions
   KOKKOS_FUNCTION
   static Pack MurphyKoop_svp(const Pack& t, const bool ice, const Mask& range_mask, const char* caller=nullptr);
 
+  //  the ice and liquid branches of MurphyKoop_svp, evaluated at all temperatures
+  KOKKOS_FUNCTION
+  static Pack MurphyKoop_svp_ice(const Pack& t);
+  KOKKOS_FUNCTION
+  static Pack MurphyKoop_svp_liq(const Pack& t);
+
+  //  tabulate MurphyKoop_svp over [t_min,t_max] with spacing dt (call from host)
+  static SvpTable create_svp_table(const Scalar t_min = 150, const Scalar t_max = 350, const Scalar dt = 0.25);
+
+  //  saturation vapor pressure from cubic interpolation of a MurphyKoop_svp table.
+  //  Temperatures outside of the table fall back to MurphyKoop_svp.
+  KOKKOS_FUNCTION
+  static Pack tabulated_svp(const Pack& t, const bool ice, const Mask& range_mask, const SvpTable& table, const char* caller=nullptr);
+
   // Calls a function to obtain the saturation vapor pressure, and then computes
   // and returns the dry saturation mixing ratio, with respect to either liquid or ice,
   // depending on value of 'ice'
@@ -91,6 +116,13 @@ struct Functions
   static Pack qv_sat_wet(const Pack& t_atm, const Pack& p_atm, const bool ice, const Mask& range_mask, const Pack& dp_wet, const Pack& dp_dry, 
                           const SaturationFcn func_idx = MurphyKoop, const char* caller=nullptr);
 
+  // Same as above, using tabulated_svp (i.e., func_idx=MurphyKoopTable)
+  KOKKOS_FUNCTION
+  static Pack qv_sat_dry(const Pack& t_atm, const Pack& p_atm, const bool ice, const Mask& range_mask, const SvpTable& table, const char* caller=nullptr);
+  KOKKOS_FUNCTION
+  static Pack qv_sat_wet(const Pack& t_atm, const Pack& p_atm, const bool ice, const Mask& range_mask, const Pack& dp_wet, const Pack& dp_dry,
+                          const SvpTable& table, const char* caller=nullptr);
+
   //checks temperature for negatives and NaNs
   KOKKOS_FUNCTION
   static void check_temperature(const Pack& t_atm, const char* caller, const Mask& range_mask);
@@ -3,6 +3,9 @@
 
 #include "physics_functions.hpp" // for ETI only but harmless for GPU
 
+#include <cmath>
+#include <string>
+
 namespace scream {
 namespace physics {
 
@@ -55,27 +58,118 @@ Functions<S,D>::MurphyKoop_svp(const Pack& t_atm, const bool ice, const Mask& ra
   const Mask liq_mask = !ice_mask;
 
   if (ice_mask.any()) {
-    //Equation (7) of the paper
-    // (good down to 110 K)
-    //creating array for storing coefficients of ice sat equation
-    static constexpr Scalar ic[]= {9.550426, 5723.265, 3.53068, 0.00728332};
-    const Pack ice_result = exp(ic[0] - (ic[1] / t_atm) + (ic[2] * log(t_atm)) - (ic[3] * t_atm));
-
-    result.set(ice_mask, ice_result);
+    result.set(ice_mask, MurphyKoop_svp_ice(t_atm));
   }
 
   if (liq_mask.any()) {
-    //Equation (10) of the paper
-    // (good for 123 < T < 332 K)
-    //creating array for storing coefficients of liq sat equation
-    static constexpr Scalar lq[] = {54.842763, 6763.22, 4.210, 0.000367, 0.0415, 218.8, 53.878,
-			 1331.22, 9.44523, 0.014025 };
-    const auto logt = log(t_atm);
-    const Pack liq_result = exp(lq[0] - (lq[1] / t_atm) - (lq[2] * logt) + (lq[3] * t_atm) +
-			   (tanh(lq[4] * (t_atm - lq[5])) * (lq[6] - (lq[7] / t_atm) -
-							 (lq[8] * logt) + lq[9] * t_atm)));
+    result.set(liq_mask, MurphyKoop_svp_liq(t_atm));
+  }
 
-    result.set(liq_mask, liq_result);
+  return result;
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Pack
+Functions<S,D>::MurphyKoop_svp_ice(const Pack& t_atm)
+{
+  //Equation (7) of the paper
+  // (good down to 110 K)
+  //creating array for storing coefficients of ice sat equation
+  static constexpr Scalar ic[]= {9.550426, 5723.265, 3.53068, 0.00728332};
+  return exp(ic[0] - (ic[1] / t_atm) + (ic[2] * log(t_atm)) - (ic[3] * t_atm));
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Pack
+Functions<S,D>::MurphyKoop_svp_liq(const Pack& t_atm)
+{
+  //Equation (10) of the paper
+  // (good for 123 < T < 332 K)
+  //creating array for storing coefficients of liq sat equation
+  static constexpr Scalar lq[] = {54.842763, 6763.22, 4.210, 0.000367, 0.0415, 218.8, 53.878,
+                                  1331.22, 9.44523, 0.014025 };
+  const auto logt = log(t_atm);
+  return exp(lq[0] - (lq[1] / t_atm) - (lq[2] * logt) + (lq[3] * t_atm) +
+             (tanh(lq[4] * (t_atm - lq[5])) * (lq[6] - (lq[7] / t_atm) -
+                                               (lq[8] * logt) + lq[9] * t_atm)));
+}
+
+template <typename S, typename D>
+typename Functions<S,D>::SvpTable
+Functions<S,D>::create_svp_table(const Scalar t_min, const Scalar t_max, const Scalar dt)
+{
+  EKAT_REQUIRE_MSG (t_min>0 && dt>0 && t_max>=t_min+3*dt,
+      "Error! Invalid temperature range/spacing for the saturation vapor pressure table.\n"
+      "  - t_min: " + std::to_string(t_min) + "\n"
+      "  - t_max: " + std::to_string(t_max) + "\n"
+      "  - dt   : " + std::to_string(dt) + "\n");
+
+  const int n = static_cast<int>(std::ceil((t_max-t_min)/dt)) + 1;
+  view_1d<Scalar> liq("svp_table_liq",n);
+  view_1d<Scalar> ice("svp_table_ice",n);
+
+  // The ice table is continued above Tmelt with the ice formula (rather than
+  // switching to liquid as MurphyKoop_svp does), so that the interpolation
+  // stencil never straddles the kink at Tmelt.
+  using policy_t = Kokkos::RangePolicy<typename KT::ExeSpace>;
+  Kokkos::parallel_for("create_svp_table", policy_t(0,n),
+                       KOKKOS_LAMBDA (const int i) {
+    const Pack t(t_min + i*dt);
+    liq(i) = MurphyKoop_svp_liq(t)[0];
+    ice(i) = MurphyKoop_svp_ice(t)[0];
+  });
+  Kokkos::fence();
+
+  SvpTable table;
+  table.liq    = liq;
+  table.ice    = ice;
+  table.t_min  = t_min;
+  table.inv_dt = 1/dt;
+  table.n      = n;
+  return table;
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Pack
+Functions<S,D>::tabulated_svp(const Pack& t_atm, const bool ice, const Mask& range_mask, const SvpTable& table, const char* caller)
+{
+  check_temperature(t_atm, caller ? caller : "tabulated_svp", range_mask);
+
+  Pack result;
+  static constexpr  auto tmelt = C::Tmelt.value;
+  const Mask ice_mask = (t_atm < tmelt) && ice;
+  Mask fallback(false);
+
+  // Four-point Lagrange interpolation on the nodes i-1,i,i+1,i+2 around t.
+  // Its error is O(dt^4): with the default 0.25K spacing it is well below
+  // 1e-6 relative to MurphyKoop_svp everywhere in the table.
+  for (int s=0; s<Pack::n; ++s) {
+    if (not range_mask[s]) continue;
+
+    const Scalar x = (t_atm[s]-table.t_min)*table.inv_dt;
+    if (not (x>=1 && x<table.n-2)) {
+      fallback.set(s,true);
+      continue;
+    }
+    const int i = static_cast<int>(x);
+    const Scalar f = x - i;
+    const auto& y = ice_mask[s] ? table.ice : table.liq;
+
+    const Scalar fm1 = f - 1;
+    const Scalar fm2 = f - 2;
+    const Scalar fp1 = f + 1;
+    result[s] = - f*fm1*fm2*y(i-1)/6 + fp1*fm1*fm2*y(i)/2
+                - fp1*f*fm2*y(i+1)/2 + fp1*f*fm1*y(i+2)/6;
+  }
+
+  // Lanes outside of range_mask get MurphyKoop_svp too, like MurphyKoop_svp
+  // itself does, but without checking their temperature.
+  const Mask compute = fallback || !range_mask;
+  if (compute.any()) {
+    result.set(compute, MurphyKoop_svp(t_atm, ice, fallback, caller));
   }
 
   return result;
@@ -137,7 +231,8 @@ Functions<S,D>::qv_sat_dry(const Pack& t_atm, const Pack& p_atm_dry, const bool
   func_idx is an optional argument to decide which scheme is to be called for saturation vapor pressure
   Currently default is set to "MurphyKoop_svp"
   func_idx = Polysvp1 (=0) --> polysvp1 (Flatau et al. 1992)
-  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)*/
+  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)
+  func_idx = MurphyKoopTable (=2) is only available via the overload taking an SvpTable*/
 
   Pack e_pres; // saturation vapor pressure [Pa]
 
@@ -148,6 +243,9 @@ Functions<S,D>::qv_sat_dry(const Pack& t_atm, const Pack& p_atm_dry, const bool
     case MurphyKoop:
       e_pres = MurphyKoop_svp(t_atm, ice, range_mask, caller);
       break;
+    case MurphyKoopTable:
+      EKAT_KERNEL_ERROR_MSG("Error! func_idx=MurphyKoopTable requires the qv_sat_dry overload taking an SvpTable.");
+      break;
     default:
       EKAT_KERNEL_ERROR_MSG("Error! Invalid func_idx supplied to qv_sat_dry.");
     }
@@ -179,6 +277,28 @@ Functions<S,D>::qv_sat_wet(const Pack& t_atm, const Pack& p_atm_dry, const bool
   return qsatdry * dp_dry / dp_wet;
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Pack
+Functions<S,D>::qv_sat_dry(const Pack& t_atm, const Pack& p_atm_dry, const bool ice, const Mask& range_mask, const SvpTable& table, const char* caller)
+{
+  const Pack e_pres = tabulated_svp(t_atm, ice, range_mask, table, caller);
+
+  static constexpr auto ep_2 = C::ep_2.value;
+  return ep_2 * e_pres / max(p_atm_dry, sp(1.e-3));
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Pack
+Functions<S,D>::qv_sat_wet(const Pack& t_atm, const Pack& p_atm_dry, const bool ice, const Mask& range_mask,
+                           const Pack& dp_wet, const Pack& dp_dry, const SvpTable& table, const char* caller)
+{
+  Pack qsatdry = qv_sat_dry(t_atm, p_atm_dry, ice, range_mask, table, caller);
+
+  return qsatdry * dp_dry / dp_wet;
+}
+
 
 
 } // namespace physics
@@ -0,0 +1,167 @@
+#include "catch2/catch.hpp"
+
+#include "share/physics/physics_functions.hpp"
+#include "share/core/eamxx_types.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+namespace {
+
+using scream::Real;
+using Device = scream::DefaultDevice;
+using PF     = scream::physics::Functions<Real,Device>;
+using Pack   = PF::Pack;
+using Mask   = PF::Mask;
+using ExeSpace = scream::KokkosTypes<Device>::ExeSpace;
+
+// Max relative difference between tabulated_svp and MurphyKoop_svp over npacks
+// packs of temperatures evenly spaced in [t_lo,t_hi]
+Real max_rel_err (const PF::SvpTable& table, const bool ice,
+                  const Real t_lo, const Real t_hi, const int npacks)
+{
+  const int nt = npacks*Pack::n;
+  const Real dt = (t_hi-t_lo)/(nt-1);
+  Real err;
+  Kokkos::parallel_reduce("svp_table_err",Kokkos::RangePolicy<ExeSpace>(0,npacks),
+                          KOKKOS_LAMBDA(const int ip, Real& max_err) {
+    Pack t;
+    for (int s=0; s<Pack::n; ++s) {
+      t[s] = t_lo + (ip*Pack::n+s)*dt;
+    }
+    const Pack exact = PF::MurphyKoop_svp(t,ice,Mask(true));
+    const Pack tab   = PF::tabulated_svp(t,ice,Mask(true),table);
+    for (int s=0; s<Pack::n; ++s) {
+      const Real e = Kokkos::abs(tab[s]-exact[s]) / exact[s];
+      max_err = e>max_err ? e : max_err;
+    }
+  },Kokkos::Max<Real>(err));
+  return err;
+}
+
+// Time per call of nrepeat evaluations of svp over npacks packs
+template<typename F>
+double time_svp (const int npacks, const int nrepeat, const F& svp)
+{
+  Kokkos::View<Pack*,Device> out("out",npacks);
+  auto run = [&]() {
+    Kokkos::parallel_for("svp_timing",Kokkos::RangePolicy<ExeSpace>(0,npacks),
+                         KOKKOS_LAMBDA(const int ip) {
+      Pack t;
+      for (int s=0; s<Pack::n; ++s) {
+        t[s] = 180 + Real(ip*Pack::n+s)/(npacks*Pack::n)*130;
+      }
+      out(ip) = svp(t);
+    });
+  };
+  run();
+  Kokkos::fence();
+  const auto start = std::chrono::steady_clock::now();
+  for (int r=0; r<nrepeat; ++r) {
+    run();
+  }
+  Kokkos::fence();
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop-start).count() / nrepeat;
+}
+
+TEST_CASE("svp_table") {
+  const auto table = PF::create_svp_table();
+
+  // Interpolation error is ~1e-8 at these temperatures, but leave room for single precision
+  const Real tol = std::max(Real(1e-6), 100*std::numeric_limits<Real>::epsilon());
+
+  SECTION ("accuracy") {
+    for (bool ice : {false, true}) {
+      const Real err = max_rel_err(table,ice,150,350,10000);
+      REQUIRE (err<tol);
+    }
+  }
+
+  SECTION ("fallback") {
+    // Outside of the table we must get MurphyKoop_svp exactly
+    Kokkos::View<int,Device> nerr("nerr");
+    Kokkos::parallel_for("svp_table_fallback",Kokkos::RangePolicy<ExeSpace>(0,1),
+                         KOKKOS_LAMBDA(const int) {
+      const Real temps[] = {120, 150, 350, 380};
+      for (Real t : temps) {
+        for (bool ice : {false, true}) {
+          const Pack exact = PF::MurphyKoop_svp(Pack(t),ice,Mask(true));
+          const Pack tab   = PF::tabulated_svp(Pack(t),ice,Mask(true),table);
+          if (tab[0]!=exact[0]) {
+            ++nerr();
+          }
+        }
+      }
+    });
+    auto nerr_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),nerr);
+    REQUIRE (nerr_h()==0);
+  }
+
+  SECTION ("qv_sat") {
+    // The table overloads of qv_sat_dry/wet agree with the MurphyKoop ones
+    Real err;
+    Kokkos::parallel_reduce("svp_table_qv_sat",Kokkos::RangePolicy<ExeSpace>(0,1000),
+                            KOKKOS_LAMBDA(const int i, Real& max_err) {
+      const Pack t (200 + i*0.1);
+      const Pack p (1e4 + i*90);
+      const Pack dp_wet (1001), dp_dry (1000);
+      for (bool ice : {false, true}) {
+        const Pack exact = PF::qv_sat_wet(t,p,ice,Mask(true),dp_wet,dp_dry,PF::MurphyKoop);
+        const Pack tab   = PF::qv_sat_wet(t,p,ice,Mask(true),dp_wet,dp_dry,table);
+        const Real e = Kokkos::abs(tab[0]-exact[0]) / exact[0];
+        max_err = e>max_err ? e : max_err;
+      }
+    },Kokkos::Max<Real>(err));
+    REQUIRE (err<tol);
+  }
+
+  SECTION ("range_mask") {
+    // Lanes outside of range_mask get the same values as in MurphyKoop_svp
+    Kokkos::View<int,Device> nerr("nerr");
+    Kokkos::parallel_for("svp_table_range_mask",Kokkos::RangePolicy<ExeSpace>(0,1),
+                         KOKKOS_LAMBDA(const int) {
+      Pack t;
+      Mask range_mask;
+      for (int s=0; s<Pack::n; ++s) {
+        t[s] = 200 + 10*s;
+        range_mask.set(s, s%2==1);
+      }
+      for (bool ice : {false, true}) {
+        const Pack exact = PF::MurphyKoop_svp(t,ice,range_mask);
+        const Pack tab   = PF::tabulated_svp(t,ice,range_mask,table);
+        for (int s=0; s<Pack::n; ++s) {
+          if (not range_mask[s] && tab[s]!=exact[s]) {
+            ++nerr();
+          }
+        }
+      }
+    });
+    auto nerr_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),nerr);
+    REQUIRE (nerr_h()==0);
+  }
+
+  SECTION ("timing") {
+    // Only report timings: the speedup depends on the architecture. Note that
+    // tabulated_svp gathers the table entries lane by lane, so it may not beat
+    // MurphyKoop_svp where the latter vectorizes well.
+    const int npacks  = 1 << 16;
+    const int nrepeat = 20;
+    for (bool ice : {false, true}) {
+      const double t_exact = time_svp(npacks,nrepeat,KOKKOS_LAMBDA(const Pack& t) {
+        return PF::MurphyKoop_svp(t,ice,Mask(true));
+      });
+      const double t_tab = time_svp(npacks,nrepeat,KOKKOS_LAMBDA(const Pack& t) {
+        return PF::tabulated_svp(t,ice,Mask(true),table);
+      });
+      std::cout << std::scientific << std::setprecision(3)
+                << " -> svp timings (ice=" << ice << "): MurphyKoop " << t_exact
+                << " s, table " << t_tab << " s, speedup "
+                << std::fixed << std::setprecision(2) << t_exact/t_tab << "\n";
+    }
+  }
+}
+
+} // anonymous namespace
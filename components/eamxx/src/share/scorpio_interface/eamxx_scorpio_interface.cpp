@@ -12,6 +12,10 @@
 #include <set>
 #include <numeric>
 #include <functional>
+#include <limits>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
 
 namespace scream {
 namespace scorpio {
@@ -210,6 +214,8 @@ int pio_iotype (IOType iotype) {
     case IOType::Adios:         iotype_int = static_cast<int>(PIO_IOTYPE_ADIOS);    break;
     case IOType::Adiosc:        iotype_int = static_cast<int>(PIO_IOTYPE_ADIOSC);   break;
     case IOType::Hdf5:          iotype_int = static_cast<int>(PIO_IOTYPE_HDF5);     break;
+    case IOType::NetCDF4c:      iotype_int = static_cast<int>(PIO_IOTYPE_NETCDF4C); break;
+    case IOType::NetCDF4p:      iotype_int = static_cast<int>(PIO_IOTYPE_NETCDF4P); break;
     default:
       EKAT_ERROR_MSG ("Unrecognized/unsupported iotype.\n");
   }
@@ -1101,7 +1107,8 @@ void clear_unused_decomps ()
 void define_var (const std::string& filename, const std::string& varname,
                  const std::string& units, const std::vector<std::string>& dimensions,
                  const std::string& dtype, const std::string& nc_dtype,
-                 const bool time_dep)
+                 const bool time_dep,
+                 const VarCompression& compression)
 {
   auto& f = impl::get_file(filename,"scorpio::define_var");
 
@@ -1128,6 +1135,7 @@ void define_var (const std::string& filename, const std::string& varname,
     var->dtype = refine_dtype(dtype);
     var->nc_dtype = refine_dtype(nc_dtype);
     var->time_dep = time_dep;
+    var->compression = compression;
     int ndims = dimensions.size() + (time_dep ? 1 : 0);
     std::vector<int> dimids;
     if (time_dep) {
@@ -1149,6 +1157,27 @@ void define_var (const std::string& filename, const std::string& varname,
     int err = PIOc_def_var(f.ncid,varname.c_str(),nctype(nc_dtype),ndims,dimids.data(),&var->ncid);
     check_scorpio_noerr(err,f.name,"variable",varname,"define_var","def_var");
 
+    EKAT_REQUIRE_MSG (compression.deflate_level>=0 && compression.deflate_level<=9,
+        "Error! Invalid deflate level (must be in [0,9]).\n"
+        " - filename: " + filename + "\n"
+        " - varname : " + varname + "\n"
+        " - level   : " + std::to_string(compression.deflate_level) + "\n");
+    EKAT_REQUIRE_MSG (compression.significant_digits>=0,
+        "Error! Invalid number of significant digits (must be non-negative).\n"
+        " - filename: " + filename + "\n"
+        " - varname : " + varname + "\n"
+        " - nsd     : " + std::to_string(compression.significant_digits) + "\n");
+
+    // Deflate/shuffle filters are only available for NetCDF4 files. Resolve the default
+    // iotype to the actual one, and do not request them for other formats.
+    const int iotype_int = pio_iotype(f.iotype);
+    const bool can_deflate = iotype_int==static_cast<int>(PIO_IOTYPE_NETCDF4C) ||
+                             iotype_int==static_cast<int>(PIO_IOTYPE_NETCDF4P);
+    if (compression.deflate_level>0 and can_deflate) {
+      err = PIOc_def_var_deflate(f.ncid,var->ncid,compression.shuffle ? 1 : 0,1,compression.deflate_level);
+      check_scorpio_noerr(err,f.name,"variable",varname,"define_var","def_var_deflate");
+    }
+
     f.vars[varname] = var;
 
     if (units!="") {
@@ -1192,6 +1221,10 @@ void define_var (const std::string& filename, const std::string& varname,
           " - varname : " + varname + "\n"
           " - old dims: " + var_dims + "\n"
           " - new dims: " + ekat::join(dimensions,",") + "\n");
+    EKAT_REQUIRE_MSG (var->compression==compression,
+        "Error! Attempt to redefine variable with different compression settings.\n"
+          " - filename: " + filename + "\n"
+          " - varname : " + varname + "\n");
   }
 }
 
@@ -1419,6 +1452,72 @@ void read_var (const std::string &filename, const std::string &varname, T* buf,
   check_scorpio_noerr (err,f.name,"variable",varname,"read_var",pioc_func);
 }
 
+template<typename T>
+void read_var_records (const std::string &filename, const std::string &varname, T* buf,
+                       const int first_record, const int num_records)
+{
+  EKAT_REQUIRE_MSG (buf!=nullptr,
+      "Error! Cannot read from provided pointer. Invalid buffer pointer.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+
+  const auto& f = impl::get_file(filename,"scorpio::read_var_records");
+        auto& var = impl::get_var(filename,varname,"scorpio::read_var_records");
+
+  EKAT_REQUIRE_MSG (var.time_dep,
+      "Error! Reading multiple records requires a time-dependent variable.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  EKAT_REQUIRE_MSG (var.decomp==nullptr,
+      "Error! Reading multiple records is only supported for non-decomposed variables.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  EKAT_REQUIRE_MSG (first_record>=0 and num_records>0 and first_record+num_records<=f.time_dim->length,
+      "Error! Time records out of bounds.\n"
+      " - filename : " + filename + "\n"
+      " - varname  : " + varname + "\n"
+      " - first rec: " + std::to_string(first_record) + "\n"
+      " - num recs : " + std::to_string(num_records) + "\n"
+      " - time len : " + std::to_string(f.time_dim->length));
+
+  // If the input pointer type already matches var.dtype, this is a no-op
+  change_var_dtype(var,get_dtype<T>(),filename);
+
+  int ndims = var.dims.size();
+  std::vector<PIO_Offset> start (ndims+1,0), count(ndims+1); // +1 for time
+  start[0] = first_record;
+  count[0] = num_records;
+  int size = num_records;
+  for (int idim=0; idim<ndims; ++idim) {
+    count[idim+1] = var.dims[idim]->length;
+    size *= var.dims[idim]->length;
+  }
+
+  // If nc data type doesn't match the input pointer, read in a tmp buffer. We cannot
+  // use the var internal buffer, since it is only sized for one record.
+  std::vector<char> tmp_buf;
+  void* io_buf = buf;
+  if (var.dtype!=var.nc_dtype) {
+    tmp_buf.resize(size*dtype_size(var.nc_dtype));
+    io_buf = tmp_buf.data();
+  }
+
+  int err = PIOc_get_vara(f.ncid,var.ncid,start.data(),count.data(),io_buf);
+  check_scorpio_noerr (err,f.name,"variable",varname,"read_var_records","get_vara");
+
+  if (var.dtype!=var.nc_dtype) {
+    if (var.nc_dtype=="int") {
+      copy_data(reinterpret_cast<int*>(io_buf),buf,size);
+    } else if (var.nc_dtype=="int64") {
+      copy_data(reinterpret_cast<long long*>(io_buf),buf,size);
+    } else if (var.nc_dtype=="float") {
+      copy_data(reinterpret_cast<float*>(io_buf),buf,size);
+    } else if (var.nc_dtype=="double") {
+      copy_data(reinterpret_cast<double*>(io_buf),buf,size);
+    }
+  }
+}
+
 // Write data from user provided buffer into the requested variable
 template<typename T>
 void write_var (const std::string &filename, const std::string &varname, const T* buf, const T* fillValue)
@@ -1448,6 +1547,27 @@ void write_var (const std::string &filename, const std::string &varname, const T
     check_scorpio_noerr (err,f.name,"variable",varname,"write_var","setframe");
   }
 
+  // Quantize a copy of the data, if requested
+  std::vector<T> quantized;
+  if constexpr (std::is_floating_point_v<T>) {
+    const int nsd = var.compression.significant_digits;
+    if (nsd>0) {
+      int n = 1;
+      if (var.decomp) {
+        n = var.decomp->offsets.size();
+      } else {
+        for (auto d : var.dims) {
+          n *= d->length;
+        }
+      }
+      quantized.assign(buf,buf+n);
+      const T fv = var.has_fill_value ? static_cast<T>(var.fill_value) : T(0);
+      const T* skip = fillValue!=nullptr ? fillValue : (var.has_fill_value ? &fv : nullptr);
+      quantize_significant_digits(quantized.data(),n,nsd,skip);
+      buf = quantized.data();
+    }
+  }
+
   std::string pioc_func;
   if (var.decomp) {
     // A decomposed variable, requires write_darray
@@ -1498,6 +1618,45 @@ void write_var (const std::string &filename, const std::string &varname, const T
   check_scorpio_noerr (err,f.name,"variable",varname,"write_var",pioc_func);
 }
 
+template<typename T>
+void quantize_significant_digits (T* data, const int n, const int nsd, const T* fill_value)
+{
+  static_assert (sizeof(T)==sizeof(std::uint32_t) || sizeof(T)==sizeof(std::uint64_t),
+      "Error! Unsupported floating point type.\n");
+  using bits_t = std::conditional_t<sizeof(T)==sizeof(std::uint64_t),std::uint64_t,std::uint32_t>;
+
+  // Keeping ceil(nsd*log2(10)) bits of mantissa guarantees a relative rounding
+  // error of at most 0.5*10^-nsd. Zeroing the remaining bits is what makes the
+  // data compressible.
+  constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+  const int keep_bits = static_cast<int>(std::ceil(nsd*std::log2(10.0)));
+  if (nsd<=0 || keep_bits>=mantissa_bits) {
+    return;
+  }
+  const int drop_bits = mantissa_bits - keep_bits;
+  const bits_t half = bits_t(1) << (drop_bits-1);
+  const bits_t mask = ~((bits_t(1) << drop_bits) - 1);
+
+  for (int i=0; i<n; ++i) {
+    const T x = data[i];
+    if (not std::isfinite(x) || (fill_value!=nullptr && x==*fill_value)) {
+      continue;
+    }
+    bits_t b;
+    std::memcpy(&b,&x,sizeof(T));
+    // Round to nearest: a carry into the exponent is still the correctly rounded value
+    bits_t r = (b + half) & mask;
+    T y;
+    std::memcpy(&y,&r,sizeof(T));
+    if (not std::isfinite(y)) {
+      // Rounding up overflowed to inf: truncate instead
+      r = b & mask;
+      std::memcpy(&y,&r,sizeof(T));
+    }
+    data[i] = y;
+  }
+}
+
 // ========================== READ/WRITE ETI ========================== //
 
 template void read_var<int>       (const std::string&, const std::string&, int*,       const int);
@@ -1506,12 +1665,19 @@ template void read_var<float>     (const std::string&, const std::string&, float
 template void read_var<double>    (const std::string&, const std::string&, double*,    const int);
 template void read_var<char>      (const std::string&, const std::string&, char*,      const int);
 
+template void read_var_records<int>    (const std::string&, const std::string&, int*,    const int, const int);
+template void read_var_records<float>  (const std::string&, const std::string&, float*,  const int, const int);
+template void read_var_records<double> (const std::string&, const std::string&, double*, const int, const int);
+
 template void write_var<int>       (const std::string&, const std::string&, const int*,       const int*);
 template void write_var<long long> (const std::string&, const std::string&, const long long*, const long long*);
 template void write_var<float>     (const std::string&, const std::string&, const float*,     const float*);
 template void write_var<double>    (const std::string&, const std::string&, const double*,    const double*);
 template void write_var<char>      (const std::string&, const std::string&, const char*,      const char*);
 
+template void quantize_significant_digits<float>  (float*,  const int, const int, const float*);
+template void quantize_significant_digits<double> (double*, const int, const int, const double*);
+
 // =============== Attributes operations ================== //
 
 bool has_global_attribute (const std::string& filename, const std::string& attname)
@@ -1666,7 +1832,15 @@ void set_attribute (const std::string& filename,
   if (varname=="GLOBAL") {
     varid = PIO_GLOBAL;
   } else {
-    varid = impl::get_var(filename,varname,"scorpio::set_any_attribute").ncid;
+    auto& var = impl::get_var(filename,varname,"scorpio::set_any_attribute");
+    varid = var.ncid;
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (attname=="_FillValue") {
+        // Remember it, so that quantization does not alter fill values
+        var.has_fill_value = true;
+        var.fill_value = att;
+      }
+    }
   }
 
   // If the file was not in define mode, we must call enddef at the end
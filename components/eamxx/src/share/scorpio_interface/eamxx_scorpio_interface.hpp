@@ -157,10 +157,12 @@ void clear_unused_decomps ();
 // ================== Variable operations ================== //
 
 // Define var on output file (cannot call on Read/Append files)
+// See VarCompression for the iotypes that honor each compression setting.
 void define_var (const std::string& filename, const std::string& varname,
                  const std::string& units, const std::vector<std::string>& dimensions,
                  const std::string& dtype, const std::string& nc_dtype,
-                 const bool time_dependent = false);
+                 const bool time_dependent = false,
+                 const VarCompression& compression = {});
 
 // Shortcut when units are not used, and dtype==nc_dtype
 void define_var (const std::string& filename, const std::string& varname,
@@ -206,11 +208,27 @@ std::vector<double> get_all_times (const std::string& filename);
 template<typename T>
 void read_var (const std::string &filename, const std::string &varname, T* buf, const int time_index = -1);
 
+// Read num_records consecutive time slices of a non-decomposed variable, starting
+// at first_record, with a single PIO call. The buffer must hold num_records slices,
+// stored one after the other (i.e., the time dim is the slowest).
+// NOTE: ETI in the cpp file for int, float, double.
+template<typename T>
+void read_var_records (const std::string &filename, const std::string &varname, T* buf,
+                       const int first_record, const int num_records);
+
 // Write data from user provided buffer into the requested variable
 // NOTE: ETI in the cpp file for int, float, double.
 template<typename T>
 void write_var (const std::string &filename, const std::string &varname, const T* buf, const T* fillValue = nullptr);
 
+// Round the n entries of data to the given number of significant decimal digits,
+// zeroing the trailing mantissa bits (so that they compress well). Non finite
+// entries, and entries equal to *fill_value (if not null), are left untouched.
+// This is what write_var does internally for vars defined with significant_digits>0.
+// NOTE: ETI in the cpp file for float, double.
+template<typename T>
+void quantize_significant_digits (T* data, const int n, const int nsd, const T* fill_value = nullptr);
+
 // =============== Attributes operations ================== //
 
 // To specify GLOBAL attributes, pass "GLOBAL" as varname
@@ -28,12 +28,32 @@ enum IOType {
   Adios,
   Adiosc,
   Hdf5,
+  NetCDF4c,   // NetCDF4/HDF5 format, serial access (supports compression)
+  NetCDF4p,   // NetCDF4/HDF5 format, parallel access
   Invalid
 };
 
 IOType str2iotype(const std::string &str);
 std::string iotype2str(const IOType iotype);
 
+// Compression/quantization settings of a variable. Deflate and shuffle are
+// only honored for the netcdf4c and netcdf4p iotypes (including a default
+// iotype resolving to one of them), and are silently ignored otherwise. Quantization (significant_digits>0) is done by
+// us on the data before it is handed to PIO, so it works with any iotype.
+// It is lossy: only the leading significant_digits decimal digits of each
+// floating point value are guaranteed to be preserved.
+struct VarCompression {
+  int  deflate_level      = 0;      // 0 means no compression, 9 is maximum
+  bool shuffle            = false;  // Enable the HDF5 shuffle filter
+  int  significant_digits = 0;      // 0 means no quantization
+
+  bool operator== (const VarCompression& rhs) const {
+    return deflate_level==rhs.deflate_level &&
+           shuffle==rhs.shuffle &&
+           significant_digits==rhs.significant_digits;
+  }
+};
+
 // The type used by PIOc for offsets
 using offset_t = std::int64_t;
 
@@ -111,7 +131,13 @@ struct PIOVar : public PIOFileEntity {
   std::string units;
 
   bool time_dep = false;
-  
+
+  VarCompression compression;
+
+  // Set when the _FillValue attribute is set, so that quantization can skip fill values
+  bool   has_fill_value = false;
+  double fill_value     = 0;
+
   // Extra safety measure: for time_dep vars, use this to check that
   // we are not writing more slices than the current time dim length.
   int num_records = 0;
@@ -2,6 +2,9 @@
 
 #include "share/scorpio_interface/eamxx_scorpio_interface.hpp"
 
+#include <cmath>
+#include <limits>
+
 namespace scream {
 
 using namespace scorpio;
@@ -202,6 +205,21 @@ TEST_CASE ("write_and_read") {
     read_var (filename,"var5",var45.data(),1);
     REQUIRE (tgt_var45==var45);
 
+    // Read both time slices at once
+    std::vector<float> var2_recs (2*dim1*dim2), tgt_var2_recs (2*dim1*dim2);
+    std::vector<int> var3_recs (2);
+    std::iota (tgt_var2_recs.begin(),tgt_var2_recs.begin()+dim1*dim2,100);
+    std::iota (tgt_var2_recs.begin()+dim1*dim2,tgt_var2_recs.end(),200);
+    REQUIRE_THROWS (read_var_records (filename,"var1",var1.data(),0,1)); // ERROR: not time dependent
+    REQUIRE_THROWS (read_var_records (filename,"var5",var45.data(),0,1)); // ERROR: decomposed var
+    REQUIRE_THROWS (read_var_records (filename,"var3",var3_recs.data(),1,2)); // ERROR: out of bounds
+
+    read_var_records (filename,"var2",var2_recs.data(),0,2);
+    REQUIRE (tgt_var2_recs==var2_recs);
+
+    read_var_records (filename,"var3",var3_recs.data(),0,2);
+    REQUIRE (var3_recs==std::vector<int>{100,200});
+
     // Cleanup
     release_file (filename);
   }
@@ -275,5 +293,85 @@ TEST_CASE ("joint_decomp") {
   finalize_subsystem ();
 }
 
+TEST_CASE ("compression") {
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  init_subsystem (comm);
+
+  std::string filename = "scorpio_interface_compression_test_np" + std::to_string(comm.size()) + ".nc";
+
+  const int ldim = 50;
+  const int dim  = ldim*comm.size();
+  const int nsd  = 3;
+  const double fill = 1e20;
+
+  std::vector<offset_t> my_offsets (ldim);
+  std::iota (my_offsets.begin(),my_offsets.end(),ldim*comm.rank());
+
+  // Spread values over many orders of magnitude, and add a fill value
+  std::vector<double> data (ldim);
+  for (int i=0; i<ldim; ++i) {
+    const int gid = my_offsets[i];
+    data[i] = (gid%2==0 ? 1 : -1) * std::pow(10.0,(gid%17)-8) * (1 + std::sqrt(gid+2.0)/10);
+  }
+  data[0] = fill;
+
+  // Write phase
+  {
+    register_file (filename,Write);
+    define_dim (filename,"dim",dim);
+    set_dim_decomp (filename,"dim",my_offsets);
+
+    VarCompression c;
+    c.deflate_level = 1;
+    c.shuffle = true;
+    c.significant_digits = nsd;
+    define_var (filename,"var_q","",{"dim"},"double","double",false,c);
+    define_var (filename,"var_q","",{"dim"},"double","double",false,c); // OK, same specs
+    REQUIRE_THROWS (define_var (filename,"var_q","",{"dim"},"double","double",false)); // ERROR: changing compression
+    set_attribute (filename,"var_q","_FillValue",fill);
+
+    c.significant_digits = 0;
+    define_var (filename,"var_lossless","",{"dim"},"double","double",false,c);
+
+    c.deflate_level = 10;
+    REQUIRE_THROWS (define_var (filename,"var_bad","",{"dim"},"double","double",false,c)); // ERROR: bad level
+    enddef (filename);
+
+    write_var (filename,"var_q",data.data());
+    write_var (filename,"var_lossless",data.data());
+    release_file (filename);
+  }
+
+  // Read phase
+  {
+    register_file (filename,Read);
+    set_dim_decomp (filename,"dim",my_offsets);
+
+    std::vector<double> var_q (ldim), var_lossless (ldim);
+    read_var (filename,"var_q",var_q.data());
+    read_var (filename,"var_lossless",var_lossless.data());
+
+    REQUIRE (var_lossless==data);
+    REQUIRE (var_q[0]==fill);
+    const double tol = 0.5*std::pow(10.0,-nsd);
+    for (int i=1; i<ldim; ++i) {
+      REQUIRE (std::abs(var_q[i]-data[i]) <= tol*std::abs(data[i]));
+    }
+
+    release_file (filename);
+  }
+
+  // The quantization helper can be also used standalone
+  std::vector<float> x = {1.0f/3, -2.0f/3, 1e-30f, -1e30f, std::numeric_limits<float>::infinity()};
+  auto y = x;
+  quantize_significant_digits(y.data(),y.size(),2);
+  for (size_t i=0; i+1<x.size(); ++i) {
+    REQUIRE (std::abs(y[i]-x[i]) <= 0.005f*std::abs(x[i]));
+  }
+  REQUIRE (y.back()==x.back());
+
+  finalize_subsystem ();
+}
 
 } // namespace scream
@@ -269,6 +269,64 @@ void CAAS<ES>::run () {
   finish_locally();
 }
 
+template <typename ES>
+CAAS<ES>::Batch::Batch (const std::vector<typename Me::Ptr>& cdrs)
+  : cdrs_(cdrs)
+{
+  cedr_throw_if(cdrs_.empty(), "CAAS::Batch needs at least one CAAS instance.");
+  const auto& c0 = *cdrs_[0];
+  const bool user_reduces = c0.user_reducer_ != nullptr;
+  nlocal_ = user_reduces ? c0.o.nlclcells_ / c0.user_reducer_->n_accum_in_place() : 1;
+  size_t nsend = 0, nrecv = 0;
+  for (const auto& c : cdrs_) {
+    cedr_throw_if( ! c->finished_setup_,
+                  "CAAS::Batch: finish_setup must be called first.");
+    cedr_throw_if(c->p_->comm() != c0.p_->comm(),
+                  "CAAS::Batch: all instances must use the same communicator.");
+    cedr_throw_if((c->user_reducer_ != nullptr) != user_reduces,
+                  "CAAS::Batch: all or none of the instances must use a UserAllReducer.");
+    if (user_reduces)
+      cedr_throw_if(c->o.nlclcells_ / c->user_reducer_->n_accum_in_place() != nlocal_,
+                    "CAAS::Batch: instances must have the same number of local "
+                    "reduction values.");
+    nsend += c->send_.size();
+    nrecv += c->recv_.size();
+  }
+  send_ = RealList("CAAS::Batch send", nsend);
+  recv_ = RealList("CAAS::Batch recv", nrecv);
+  // Point each instance's buffers into the packed ones. Because send_ is
+  // formatted as sendbuf(nlocal, nfld) and the instances' nfld blocks are
+  // concatenated, the packed buffer has the same format.
+  size_t send_os = 0, recv_os = 0;
+  for (const auto& c : cdrs_) {
+    const size_t ns = c->send_.size(), nr = c->recv_.size();
+    c->send_ = Kokkos::subview(send_, std::make_pair(send_os, send_os + ns));
+    c->recv_ = Kokkos::subview(recv_, std::make_pair(recv_os, recv_os + nr));
+    send_os += ns;
+    recv_os += nr;
+  }
+}
+
+template <typename ES>
+void CAAS<ES>::Batch::run () {
+  for (const auto& c : cdrs_) {
+    cedr_assert(c->finished_setup_);
+    c->reduce_locally();
+  }
+  const auto& c0 = *cdrs_[0];
+  if (c0.user_reducer_)
+    (*c0.user_reducer_)(*c0.p_, send_.data(), recv_.data(), nlocal_,
+                        recv_.size(), MPI_SUM);
+  else {
+    const int err = mpi::all_reduce(*c0.p_, send_.data(), recv_.data(),
+                                    send_.size(), MPI_SUM);
+    cedr_throw_if(err != MPI_SUCCESS,
+                  "CAAS::Batch::run MPI_Allreduce returned " << err);
+  }
+  for (const auto& c : cdrs_)
+    c->finish_locally();
+}
+
 namespace test {
 struct TestCAAS : public cedr::test::TestRandomized {
   typedef CAAS<Kokkos::DefaultExecutionSpace> CAAST;
@@ -304,9 +362,9 @@ struct TestCAAS : public cedr::test::TestRandomized {
 
   TestCAAS (const mpi::Parallel::Ptr& p, const Int& ncells,
             const bool use_own_reducer, const bool external_memory,
-            const bool verbose)
+            const bool verbose, const Int nbatch = 1)
     : TestRandomized("CAAS", p, ncells, verbose),
-      p_(p), external_memory_(external_memory)
+      p_(p), external_memory_(external_memory), nbatch_(nbatch)
   {
     const auto np = p->size(), rank = p->rank();
     nlclcells_ = ncells / np;
@@ -322,6 +380,9 @@ struct TestCAAS : public cedr::test::TestRandomized {
       reducer = std::make_shared<TestAllReducer>(n_accum);
     }
     caas_ = std::make_shared<CAAST>( p, nlclcells_, reducer);
+    // The other members of a batch solve copies of caas_'s problem.
+    for (Int i = 1; i < nbatch_; ++i)
+      others_.push_back(std::make_shared<CAAST>(p, nlclcells_, reducer));
     init();
   }
 
@@ -348,9 +409,11 @@ struct TestCAAS : public cedr::test::TestRandomized {
       t.idx = idx++;
       tracers.push_back(t);
       caas_->declare_tracer(t.problem_type, 0);
+      for (const auto& o : others_) o->declare_tracer(t.problem_type, 0);
     }
     tracers_ = tracers;
     caas_->end_tracer_declarations();
+    for (const auto& o : others_) o->end_tracer_declarations();
     if (external_memory_) {
       size_t l2r_sz, r2l_sz;
       caas_->get_buffers_sizes(l2r_sz, r2l_sz);
@@ -359,17 +422,50 @@ struct TestCAAS : public cedr::test::TestRandomized {
       caas_->set_buffers(buf1_.data(), buf2_.data());
     }
     caas_->finish_setup();
+    for (const auto& o : others_) o->finish_setup();
+    if (nbatch_ > 1) {
+      std::vector<CAAST::Ptr> cdrs(1, caas_);
+      cdrs.insert(cdrs.end(), others_.begin(), others_.end());
+      batch_ = std::make_shared<CAAST::Batch>(cdrs);
+    }
   }
 
   void run_impl (const Int trial) override {
-    caas_->run();
+    if ( ! batch_) {
+      caas_->run();
+      return;
+    }
+    const auto d = caas_->get_device_op().d_;
+    for (const auto& o : others_)
+      Kokkos::deep_copy(o->get_device_op().d_, d);
+    batch_->run();
+  }
+
+  // Each member of the batch solved the same problem, so each must have
+  // caas_'s solution up to the ordering of sums in the packed all-reduce.
+  Int check_batch () {
+    const Real tol = 1e2*std::numeric_limits<Real>::epsilon();
+    Int nerr = 0;
+    const auto d = caas_->get_device_op().d_;
+    const auto d_h = Kokkos::create_mirror_view(d);
+    Kokkos::deep_copy(d_h, d);
+    for (const auto& o : others_) {
+      const auto od = o->get_device_op().d_;
+      const auto od_h = Kokkos::create_mirror_view(od);
+      Kokkos::deep_copy(od_h, od);
+      for (size_t i = 0; i < d_h.size(); ++i)
+        if (util::reldif(d_h(i), od_h(i)) > tol) ++nerr;
+    }
+    return nerr;
   }
 
 private:
   mpi::Parallel::Ptr p_;
   bool external_memory_;
-  Int nlclcells_;
+  Int nlclcells_, nbatch_;
   CAAST::Ptr caas_;
+  std::vector<CAAST::Ptr> others_;
+  CAAST::Batch::Ptr batch_;
   typename CAAST::RealList buf1_, buf2_;
 
   static Int get_nllclcells (const Int& ncells, const Int& np, const Int& rank) {
@@ -390,9 +486,33 @@ Int unittest (const mpi::Parallel::Ptr& p) {
       for (const bool external_memory : {false, true})
         nerr += TestCAAS(p, ncells, own_reducer, external_memory, false)
           .run<TestCAAS::CAAST>(1, false);
+    for (const bool own_reducer : {false, true}) {
+      TestCAAS t(p, ncells, own_reducer, false, false, 3);
+      nerr += t.run<TestCAAS::CAAST>(1, false);
+      nerr += t.check_batch();
+    }
   }
   return nerr;
 }
+
+void perftest_batched (const mpi::Parallel::Ptr& p, const Long ncells,
+                       const Int nbatch, const Int nrepeat) {
+  std::vector<TestCAAS::CAAST::Ptr> cdrs;
+  for (Int i = 0; i < nbatch; ++i) {
+    cdrs.push_back(std::make_shared<TestCAAS::CAAST>(p, ncells / p->size(), nullptr));
+    cdrs.back()->declare_tracer(ProblemType::shapepreserve | ProblemType::conserve, 0);
+    cdrs.back()->end_tracer_declarations();
+    cdrs.back()->finish_setup();
+  }
+  const auto t_separate = cedr::test::time_per_call(*p, nrepeat, [&] () {
+    for (const auto& c : cdrs) c->run();
+  });
+  TestCAAS::CAAST::Batch batch(cdrs);
+  const auto t_batched = cedr::test::time_per_call(*p, nrepeat, [&] () {
+    batch.run();
+  });
+  cedr::test::print_batch_timing(*p, "CAAS", ncells, nbatch, t_separate, t_batched);
+}
 } // namespace test
 } // namespace caas
 } // namespace cedr
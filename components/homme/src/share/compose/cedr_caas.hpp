@@ -88,6 +88,33 @@ public:
 
   void run() override;
 
+  // Run several CAAS instances, e.g. for several tracer groups or several
+  // transport substeps, with one global reduction rather than one per
+  // instance. Construct the Batch after each instance's finish_setup. The
+  // instances' reduction buffers are then made views into the Batch's packed
+  // buffers, so no packing copies are needed. An instance may still be run
+  // alone.
+  //   All instances must share the same communicator and UserAllReducer
+  // setting. If a UserAllReducer is used, all instances must have the same
+  // number of local reduction values, as the packed buffer is formatted as
+  // sendbuf(nlocal, sum of nfld).
+  class Batch {
+  public:
+    typedef std::shared_ptr<Batch> Ptr;
+
+    Batch(const std::vector<typename Me::Ptr>& cdrs);
+
+    Int get_num_cdrs () const { return cdrs_.size(); }
+
+    // Equivalent to calling run() on each instance.
+    void run();
+
+  private:
+    std::vector<typename Me::Ptr> cdrs_;
+    RealList send_, recv_;
+    Int nlocal_;
+  };
+
 protected:
   typedef cedr::impl::Unmanaged<RealList> UnmanagedRealList;
 
@@ -119,6 +146,11 @@ private:
 
 namespace test {
 Int unittest(const mpi::Parallel::Ptr& p);
+
+// Compare nbatch separate CAAS runs against one batched run of the same
+// problems.
+void perftest_batched(const mpi::Parallel::Ptr& p, const Long ncells,
+                      const Int nbatch, const Int nrepeat);
 } // namespace test
 } // namespace caas
 } // namespace cedr
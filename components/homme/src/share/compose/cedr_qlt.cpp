@@ -2,6 +2,7 @@
 // the BSD license; see LICENSE in the top-level directory.
 
 #include "cedr_qlt.hpp"
+#include "cedr_caas.hpp"
 #include "cedr_test_randomized.hpp"
 
 #include <sys/time.h>
@@ -639,6 +640,128 @@ void QLT<ES>::run () {
   Timer::stop(Timer::qltrunr2l);
 }
 
+template <typename ES>
+QLT<ES>::Batch::Batch (const std::vector<typename Me::Ptr>& qlts)
+  : qlts_(qlts)
+{
+  cedr_throw_if(qlts_.empty(), "QLT::Batch needs at least one QLT instance.");
+  const auto& q0 = *qlts_[0];
+  const Int nq = qlts_.size();
+  l2rndps_.resize(nq); r2lndps_.resize(nq);
+  l2rndps_os_.resize(nq+1); r2lndps_os_.resize(nq+1);
+  l2rndps_os_[0] = r2lndps_os_[0] = 0;
+  for (Int k = 0; k < nq; ++k) {
+    const auto& q = *qlts_[k];
+    cedr_throw_if( ! q.o.bd_.inited(),
+                  "QLT::Batch: finish_setup must be called first.");
+    cedr_throw_if(q.p_->comm() != q0.p_->comm(),
+                  "QLT::Batch: all instances must use the same communicator.");
+    // The instances must have the same comm pattern.
+    bool same = (q.ns_->nslots == q0.ns_->nslots &&
+                 q.ns_->levels.size() == q0.ns_->levels.size());
+    for (size_t il = 0; same && il < q0.ns_->levels.size(); ++il) {
+      const auto& a = q.ns_->levels[il];
+      const auto& b = q0.ns_->levels[il];
+      same = a.me.size() == b.me.size() && a.kids.size() == b.kids.size();
+      for (size_t i = 0; same && i < a.me.size(); ++i)
+        same = (a.me[i].rank == b.me[i].rank && a.me[i].offset == b.me[i].offset &&
+                a.me[i].size == b.me[i].size);
+      for (size_t i = 0; same && i < a.kids.size(); ++i)
+        same = (a.kids[i].rank == b.kids[i].rank &&
+                a.kids[i].offset == b.kids[i].offset &&
+                a.kids[i].size == b.kids[i].size);
+    }
+    cedr_throw_if( ! same, "QLT::Batch: all instances must be built on the same tree.");
+    l2rndps_[k] = q.o.md_.a_h.prob2bl2r[q.o.md_.nprobtypes];
+    r2lndps_[k] = q.o.md_.a_h.prob2br2l[q.o.md_.nprobtypes];
+    l2rndps_os_[k+1] = l2rndps_os_[k] + l2rndps_[k];
+    r2lndps_os_[k+1] = r2lndps_os_[k] + r2lndps_[k];
+  }
+  l2rndps_tot_ = l2rndps_os_[nq];
+  r2lndps_tot_ = r2lndps_os_[nq];
+  l2r_buf_ = RealList("QLT::Batch l2r", l2rndps_tot_*q0.ns_->nslots);
+  r2l_buf_ = RealList("QLT::Batch r2l", r2lndps_tot_*q0.ns_->nslots);
+}
+
+template <typename ES>
+void QLT<ES>::Batch::copy (const bool l2r, const bool pack,
+                           const MPIMetaData& mmd) const {
+  const auto& ndps = l2r ? l2rndps_ : r2lndps_;
+  const auto& ndps_os = l2r ? l2rndps_os_ : r2lndps_os_;
+  const Int ndps_tot = l2r ? l2rndps_tot_ : r2lndps_tot_;
+  const auto& buf = l2r ? l2r_buf_ : r2l_buf_;
+  for (size_t k = 0; k < qlts_.size(); ++k) {
+    const auto& bd = qlts_[k]->o.bd_;
+    const auto& data = l2r ? bd.l2r_data : bd.r2l_data;
+    const Int n = mmd.size*ndps[k];
+    const Int bos = mmd.offset*ndps_tot + mmd.size*ndps_os[k];
+    const Int dos = mmd.offset*ndps[k];
+    const auto b = Kokkos::subview(buf, std::make_pair(bos, bos + n));
+    const auto d = Kokkos::subview(data, std::make_pair(dos, dos + n));
+    if (pack)
+      Kokkos::deep_copy(b, d);
+    else
+      Kokkos::deep_copy(d, b);
+  }
+}
+
+template <typename ES>
+void QLT<ES>::Batch::run () {
+  const auto& q0 = *qlts_[0];
+  const auto& p = *q0.p_;
+  const auto& levels = q0.ns_->levels;
+  const Int nq = qlts_.size();
+  Timer::start(Timer::qltrunl2r);
+  for (size_t il = 0; il < levels.size(); ++il) {
+    const auto& lvl = levels[il];
+    if (lvl.kids.size()) {
+      for (size_t i = 0; i < lvl.kids.size(); ++i) {
+        const auto& mmd = lvl.kids[i];
+        mpi::irecv(p, l2r_buf_.data() + mmd.offset*l2rndps_tot_,
+                   mmd.size*l2rndps_tot_, mmd.rank, tree::NodeSets::mpitag,
+                   &lvl.kids_req[i]);
+      }
+      Timer::start(Timer::waitall);
+      mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
+      Timer::stop(Timer::waitall);
+      for (const auto& mmd : lvl.kids) copy(true, false, mmd);
+    }
+    for (Int k = 0; k < nq; ++k)
+      qlts_[k]->l2r_combine_kid_data(il, l2rndps_[k]);
+    for (const auto& mmd : lvl.me) {
+      copy(true, true, mmd);
+      mpi::isend(p, l2r_buf_.data() + mmd.offset*l2rndps_tot_,
+                 mmd.size*l2rndps_tot_, mmd.rank, tree::NodeSets::mpitag);
+    }
+  }
+  Timer::stop(Timer::qltrunl2r); Timer::start(Timer::qltrunr2l);
+  for (Int k = 0; k < nq; ++k)
+    qlts_[k]->root_compute(l2rndps_[k], r2lndps_[k]);
+  for (size_t il = levels.size(); il > 0; --il) {
+    const auto& lvl = levels[il-1];
+    if (lvl.me.size()) {
+      for (size_t i = 0; i < lvl.me.size(); ++i) {
+        const auto& mmd = lvl.me[i];
+        mpi::irecv(p, r2l_buf_.data() + mmd.offset*r2lndps_tot_,
+                   mmd.size*r2lndps_tot_, mmd.rank, tree::NodeSets::mpitag,
+                   &lvl.me_recv_req[i]);
+      }
+      Timer::start(Timer::waitall);
+      mpi::waitall(lvl.me_recv_req.size(), lvl.me_recv_req.data());
+      Timer::stop(Timer::waitall);
+      for (const auto& mmd : lvl.me) copy(false, false, mmd);
+    }
+    for (Int k = 0; k < nq; ++k)
+      qlts_[k]->r2l_solve_qp(il-1, l2rndps_[k], r2lndps_[k]);
+    for (const auto& mmd : lvl.kids) {
+      copy(false, true, mmd);
+      mpi::isend(p, r2l_buf_.data() + mmd.offset*r2lndps_tot_,
+                 mmd.size*r2lndps_tot_, mmd.rank, tree::NodeSets::mpitag);
+    }
+  }
+  Timer::stop(Timer::qltrunr2l);
+}
+
 namespace test {
 using namespace impl;
 
@@ -648,28 +771,51 @@ public:
 
   TestQLT (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
            const Int& ncells, const bool external_memory, const bool verbose,
-           CDR::Options options)
+           CDR::Options options, const Int nbatch = 1)
     : TestRandomized("QLT", p, ncells, verbose, options),
-      qlt_(p, ncells, tree, options), tree_(tree), external_memory_(external_memory)
+      qlt_(std::make_shared<QLTT>(p, ncells, tree, options)), tree_(tree),
+      external_memory_(external_memory)
   {
-    if (verbose) qlt_.print(std::cout);
+    if (verbose) qlt_->print(std::cout);
+    // The other members of a batch solve copies of qlt_'s problem.
+    for (Int i = 1; i < nbatch; ++i)
+      others_.push_back(std::make_shared<QLTT>(p, ncells, tree, options));
     init();
   }
 
+  // Each member of the batch solved the same problem with the same sequence
+  // of operations, so each must have qlt_'s solution exactly.
+  Int check_batch () {
+    Int nerr = 0;
+    const auto r2l = qlt_->get_device_op().bd_.r2l_data;
+    const auto r2l_h = Kokkos::create_mirror_view(r2l);
+    Kokkos::deep_copy(r2l_h, r2l);
+    for (const auto& o : others_) {
+      const auto or2l = o->get_device_op().bd_.r2l_data;
+      const auto or2l_h = Kokkos::create_mirror_view(or2l);
+      Kokkos::deep_copy(or2l_h, or2l);
+      for (size_t i = 0; i < r2l_h.size(); ++i)
+        if (r2l_h(i) != or2l_h(i)) ++nerr;
+    }
+    return nerr;
+  }
+
 private:
-  QLTT qlt_;
+  QLTT::Ptr qlt_;
   tree::Node::Ptr tree_;
   bool external_memory_;
+  std::vector<QLTT::Ptr> others_;
+  QLTT::Batch::Ptr batch_;
   typename QLTT::RealList buf1_, buf2_;
 
-  CDR& get_cdr () override { return qlt_; }
+  CDR& get_cdr () override { return *qlt_; }
 
   void init_numbering () override {
     init_numbering(tree_);
   }
 
   void init_numbering (const tree::Node::Ptr& node) {
-    check(qlt_);
+    check(*qlt_);
     // TestQLT doesn't actually care about a particular ordering, as there is no
     // geometry to the test problem. However, use *some* ordering to model what
     // a real problem must do.
@@ -692,21 +838,30 @@ private:
   }
 
   void init_tracers () override {
-    for (const auto& t : tracers_)
-      qlt_.declare_tracer(t.problem_type, 0);
-    qlt_.end_tracer_declarations();
+    for (const auto& t : tracers_) {
+      qlt_->declare_tracer(t.problem_type, 0);
+      for (const auto& o : others_) o->declare_tracer(t.problem_type, 0);
+    }
+    qlt_->end_tracer_declarations();
+    for (const auto& o : others_) o->end_tracer_declarations();
     if (external_memory_) {
       size_t l2r_sz, r2l_sz;
-      qlt_.get_buffers_sizes(l2r_sz, r2l_sz);
+      qlt_->get_buffers_sizes(l2r_sz, r2l_sz);
       buf1_ = typename QLTT::RealList("buf1", l2r_sz);
       buf2_ = typename QLTT::RealList("buf2", r2l_sz);
-      qlt_.set_buffers(buf1_.data(), buf2_.data());
+      qlt_->set_buffers(buf1_.data(), buf2_.data());
+    }
+    qlt_->finish_setup();
+    for (const auto& o : others_) o->finish_setup();
+    if ( ! others_.empty()) {
+      std::vector<QLTT::Ptr> qlts(1, qlt_);
+      qlts.insert(qlts.end(), others_.begin(), others_.end());
+      batch_ = std::make_shared<QLTT::Batch>(qlts);
     }
-    qlt_.finish_setup();
 #ifndef NDEBUG
-    cedr_assert(qlt_.get_num_tracers() == static_cast<Int>(tracers_.size()));
+    cedr_assert(qlt_->get_num_tracers() == static_cast<Int>(tracers_.size()));
     for (size_t i = 0; i < tracers_.size(); ++i) {
-      const auto pt = qlt_.get_problem_type(i);
+      const auto pt = qlt_->get_problem_type(i);
       cedr_assert((pt == ((tracers_[i].problem_type | ProblemType::consistent) &
                           ~ProblemType::nonnegative)) ||
                   (pt == ((tracers_[i].problem_type | ProblemType::nonnegative) &
@@ -718,7 +873,14 @@ private:
   void run_impl (const Int trial) override {
     MPI_Barrier(p_->comm());
     Timer::start(Timer::qltrun);
-    qlt_.run();
+    if (batch_) {
+      const auto l2r = qlt_->get_device_op().bd_.l2r_data;
+      for (const auto& o : others_)
+        Kokkos::deep_copy(o->get_device_op().bd_.l2r_data, l2r);
+      batch_->run();
+    } else {
+      qlt_->run();
+    }
     MPI_Barrier(p_->comm());
     Timer::stop(Timer::qltrun);
     if (trial == 0) {
@@ -742,6 +904,35 @@ Int test_qlt (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
   return TestQLT(p, tree, ncells, external_memory, verbose, options)
     .run<TestQLT::QLTT>(nrepeat, write);
 }
+
+Int test_qlt_batched (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
+                      const Int& ncells, const Int nbatch) {
+  TestQLT t(p, tree, ncells, false, false, CDR::Options(), nbatch);
+  Int nerr = t.run<TestQLT::QLTT>(1, false);
+  nerr += t.check_batch();
+  return nerr;
+}
+
+void perftest_batched (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
+                       const Int& ncells, const Int nbatch, const Int nrepeat) {
+  typedef TestQLT::QLTT QLTT;
+  std::vector<QLTT::Ptr> qlts;
+  for (Int i = 0; i < nbatch; ++i) {
+    qlts.push_back(std::make_shared<QLTT>(p, ncells, tree));
+    qlts.back()->declare_tracer(ProblemType::shapepreserve | ProblemType::conserve |
+                                ProblemType::consistent, 0);
+    qlts.back()->end_tracer_declarations();
+    qlts.back()->finish_setup();
+  }
+  const auto t_separate = cedr::test::time_per_call(*p, nrepeat, [&] () {
+    for (const auto& q : qlts) q->run();
+  });
+  QLTT::Batch batch(qlts);
+  const auto t_batched = cedr::test::time_per_call(*p, nrepeat, [&] () {
+    batch.run();
+  });
+  cedr::test::print_batch_timing(*p, "QLT", ncells, nbatch, t_separate, t_batched);
+}
 } // namespace test
 
 Int unittest_QLT (const Parallel::Ptr& p, const bool write_requested=false) {
@@ -768,6 +959,8 @@ Int unittest_QLT (const Parallel::Ptr& p, const bool write_requested=false) {
                                  prefer_mass_con_to_bounds, false);
         }
       }
+      Mesh m(szs[is], p, dists[id]);
+      nerr += test::test_qlt_batched(p, make_tree(m, false), m.ncell(), 3);
     }
   }
   return nerr;
@@ -795,6 +988,10 @@ Int run_unit_and_randomized_tests (const Parallel::Ptr& p, const Input& in) {
     test::test_qlt(p, tree, in.ncells, in.nrepeat, false, false, false, in.verbose);
     Timer::stop(Timer::total);
     if (p->amroot()) Timer::print();
+    if (in.nbatch > 1) {
+      test::perftest_batched(p, tree, in.ncells, in.nbatch, in.nrepeat);
+      caas::test::perftest_batched(p, in.ncells, in.nbatch, in.nrepeat);
+    }
   }
   return nerr;
 }
@@ -185,6 +185,38 @@ public:
 
   void run() override;
 
+  // Run several QLT instances built on the same tree, e.g. for several tracer
+  // groups or several transport substeps, with one tree traversal. At each
+  // level, the data for a comm partner are packed across instances into one
+  // message, so the number of messages and waits per level is independent of
+  // the number of instances. Construct the Batch after each instance's
+  // finish_setup. An instance may still be run alone.
+  class Batch {
+  public:
+    typedef std::shared_ptr<Batch> Ptr;
+
+    Batch(const std::vector<typename Me::Ptr>& qlts);
+
+    Int get_num_cdrs () const { return qlts_.size(); }
+
+    // Equivalent to calling run() on each instance.
+    void run();
+
+  private:
+    typedef tree::NodeSets::Level::MPIMetaData MPIMetaData;
+
+    std::vector<typename Me::Ptr> qlts_;
+    // Per instance, the number of data per slot and the offset to the
+    // instance's data within a packed message, in units of slots.
+    std::vector<Int> l2rndps_, r2lndps_, l2rndps_os_, r2lndps_os_;
+    Int l2rndps_tot_, r2lndps_tot_;
+    RealList l2r_buf_, r2l_buf_;
+
+    // Copy between the instances' bulk data and the packed buffer for the
+    // message described by mmd.
+    void copy(const bool l2r, const bool pack, const MPIMetaData& mmd) const;
+  };
+
 protected:
   static void init(const std::string& name, IntList& d,
                    typename IntList::HostMirror& h, size_t n);
@@ -221,7 +253,9 @@ PRIVATE_CUDA:
 namespace test {
 struct Input {
   bool unittest, perftest, write;
-  Int ncells, ntracers, tracer_type, nrepeat;
+  // If nbatch > 1, the performance test also compares nbatch separate runs
+  // against one batched run.
+  Int ncells, ntracers, tracer_type, nrepeat, nbatch;
   bool pseudorandom, verbose;
 };
 
@@ -238,6 +272,11 @@ Int test_qlt(const Parallel::Ptr& p, const tree::Node::Ptr& tree, const Int& nce
              // Set CDR::Options.prefer_numerical_mass_conservation_to_numerical_bounds.
              const bool prefer_mass_con_to_bounds,
              const bool verbose);
+
+// Compare nbatch separate QLT runs against one batched run of the same
+// problems.
+void perftest_batched(const Parallel::Ptr& p, const tree::Node::Ptr& tree,
+                      const Int& ncells, const Int nbatch, const Int nrepeat);
 } // namespace test
 } // namespace qlt
 } // namespace cedr
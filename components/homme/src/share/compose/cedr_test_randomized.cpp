@@ -431,5 +431,30 @@ void TestRandomized::init () {
   init_tracers();
 }
 
+Real time_per_call (const mpi::Parallel& p, const Int nrepeat,
+                    const std::function<void()>& f) {
+  f();
+  Kokkos::fence();
+  MPI_Barrier(p.comm());
+  const double t0 = MPI_Wtime();
+  for (Int i = 0; i < nrepeat; ++i) f();
+  Kokkos::fence();
+  const Real et_lcl = (MPI_Wtime() - t0)/std::max<Int>(1, nrepeat);
+  Real et_gbl = 0;
+  mpi::all_reduce(p, &et_lcl, &et_gbl, 1, MPI_MAX);
+  return et_gbl;
+}
+
+void print_batch_timing (const mpi::Parallel& p, const std::string& cdr_name,
+                         const Long ncells, const Int nbatch,
+                         const Real t_separate, const Real t_batched) {
+  if ( ! p.amroot()) return;
+  printf("%-5s batch: np %6d ncells %10ld nbatch %3d separate %10.3e "
+         "batched %10.3e speedup %6.2f\n",
+         cdr_name.c_str(), static_cast<int>(p.size()), static_cast<long>(ncells),
+         static_cast<int>(nbatch), t_separate, t_batched,
+         t_batched > 0 ? t_separate/t_batched : 0.0);
+}
+
 } // namespace test
 } // namespace cedr
@@ -8,11 +8,24 @@
 #include "cedr_mpi.hpp"
 #include "cedr_util.hpp"
 
+#include <functional>
 #include <vector>
 
 namespace cedr {
 namespace test {
 
+// Scaling benchmark support for batched CDR runs. time_per_call runs f once to
+// warm up, then nrepeat times, and returns the max over ranks of the mean time
+// per call.
+Real time_per_call(const mpi::Parallel& p, const Int nrepeat,
+                   const std::function<void()>& f);
+
+// On root, print the per-call time of nbatch separate runs and of one batched
+// run, and the speedup.
+void print_batch_timing(const mpi::Parallel& p, const std::string& cdr_name,
+                        const Long ncells, const Int nbatch,
+                        const Real t_separate, const Real t_batched);
+
 class TestRandomized {
 public:
   TestRandomized(const std::string& cdr_name, const mpi::Parallel::Ptr& p,
@@ -734,8 +734,6 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
       parallel_for(ttrg, f2);
     }
   };
-  Kokkos::fence();
-  parallel_for(m_tp_ne, fe);
 
   const auto dp_g = m_state.m_dp3d;
   const auto q_g = m_tracers.Q;
@@ -743,6 +741,23 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   const auto qlim = m_tracers.qlim;
   const auto tu_ne_qsize = m_tu_ne_qsize;
 
+  // The limiter bounds depend only on the input FV q, so compute them first and
+  // let the extrema halo exchange proceed while the state and tracers are
+  // remapped.
+  const auto fxq = KOKKOS_LAMBDA (const MT& team) {
+    KernelVariables kv(team, qsize, tu_ne_qsize);
+    const auto ie = kv.ie, iq = kv.iq;
+    const auto all = Kokkos::ALL();
+    calc_extrema(kv, nf2, nlevpk, Kokkos::subview(q, ie, all, iq, all),
+                 evus1(&qlim(ie,iq,0,0), nlevpk), evus1(&qlim(ie,iq,1,0), nlevpk));
+  };
+  Kokkos::fence();
+  parallel_for(m_tp_ne_qsize, fxq);
+  Kokkos::fence();
+  m_extrema_be->pack_and_send_min_max();
+
+  parallel_for(m_tp_ne, fe);
+
   const auto feq = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, qsize, tu_ne_qsize);
     const auto ie = kv.ie, iq = kv.iq;
@@ -760,13 +775,6 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
     const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
 
     {
-      // Get limiter bounds.
-      const evus2 qf_ie(&r2w(1,0,0,0), nf2, nlevpk);
-      loop_ik(ttrf, tvr, [&] (int i, int k) { qf_ie(i,k) = q(ie,i,iq,k); });
-      kv.team_barrier();
-      calc_extrema(kv, nf2, nlevpk, qf_ie,
-                   evus1(&qlim(ie,iq,0,0), nlevpk), evus1(&qlim(ie,iq,1,0), nlevpk));
-      kv.team_barrier();
       // FV Q_ten
       //   GLL Q0 -> FV Q0
       const evus2 dqf_ie(&r2w(0,0,0,0), nf2, nlevpk);
@@ -778,7 +786,7 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
         0, evus3(dqf_ie.data(), nf2, 1, nlevpk));
       kv.team_barrier();
       //   FV Q_ten = FV Q1 - FV Q0
-      loop_ik(ttrf, tvr, [&] (int i, int k) { dqf_ie(i,k) = qf_ie(i,k) - dqf_ie(i,k); });
+      loop_ik(ttrf, tvr, [&] (int i, int k) { dqf_ie(i,k) = q(ie,i,iq,k) - dqf_ie(i,k); });
       kv.team_barrier();
       // GLL Q_ten
       const evus_np2_nlev dqg_ie(rw2.data());
@@ -792,9 +800,10 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   };
   Kokkos::fence();
   parallel_for(m_tp_ne_qsize, feq);
+  Kokkos::fence();
 
-  // Halo exchange extrema data.
-  m_extrema_be->exchange_min_max();
+  // Finish the halo exchange of the extrema data.
+  m_extrema_be->recv_and_unpack_min_max();
 
   const auto geq = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, qsize, tu_ne_qsize);
@@ -50,6 +50,37 @@ class SphereOperators
 
   template<int NUM_LEVELS>
   using DefaultProvider = ExecViewUnmanaged<const Scalar [NP][NP][NUM_LEVELS]>;
+
+  // Applies dvv (or its transpose) to the NP values along one line of an element:
+  //   out(i, sum_k d(i,k)*in(k)),  i = 0,...,NP-1
+  // The inputs are loaded once and reused for all NP outputs, so out may alias in.
+  // NP is a compile-time constant, so all loops are fully unrolled.
+  template<bool Transpose, typename In, typename Out>
+  KOKKOS_FORCEINLINE_FUNCTION static void
+  dvv_line (const Real (&d)[NP][NP], const In& in, const Out& out)
+  {
+    Scalar x[NP];
+    for (int k = 0; k < NP; ++k) {
+      x[k] = in(k);
+    }
+    for (int i = 0; i < NP; ++i) {
+      Scalar y;
+      for (int k = 0; k < NP; ++k) {
+        y += (Transpose ? d[k][i] : d[i][k]) * x[k];
+      }
+      out(i, y);
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void
+  load_dvv (Real (&d)[NP][NP]) const
+  {
+    for (int i = 0; i < NP; ++i) {
+      for (int k = 0; k < NP; ++k) {
+        d[i][k] = dvv(i, k);
+      }
+    }
+  }
 public:
 
 
@@ -1151,6 +1182,326 @@ public:
     vlaplace_sphere_wk_contra<NUM_LEV_OUT,NUM_LEV_IN>(kv, nu_ratio, vector, laplace, NUM_LEV_REQUEST);
   }//end of vlaplace_sphere_wk_contra
 
+  // ================ SMALL-GEMM MULTI-LEVEL IMPLEMENTATION ================= //
+
+  // These variants compute the derivatives as small dense products. Each thread
+  // takes one line (a row or a column) of the element and multiplies dvv, held
+  // in registers, by the NP values along the line, one level pack at a time.
+  // In the implementation above, each point reloads the NP inputs it needs;
+  // here each input is loaded once per line and reused for all NP outputs.
+  // The price is an extra pass through the team buffers. Results are BFB with
+  // the operators above, except for divergence_sphere_wk_gemm (and hence
+  // laplace_simple_gemm), which sums the two directions separately.
+  // See sphere_op_ml.cpp for a comparison of the two implementations.
+
+  template<int NUM_LEV_OUT, typename InputProvider>
+  KOKKOS_INLINE_FUNCTION void
+  gradient_sphere_gemm (const KernelVariables &kv,
+                        const InputProvider& scalar,
+                        const ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_OUT]>& grad_s,
+                        const int NUM_LEV_REQUEST) const
+  {
+    assert(NUM_LEV_REQUEST>=0);
+    assert(NUM_LEV_REQUEST<=NUM_LEV_OUT);
+
+    // Make sure the buffers have been created
+    assert (vector_buf_ml.size()>0);
+
+    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    // Note: laplace_simple_gemm passes buffer 0 as grad_s
+    vector_buf<NUM_LEV_OUT> ds(Homme::subview(vector_buf_ml,kv.team_idx,1).data());
+
+    Real d[NP][NP];
+    load_dvv(d);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, 2*NP),
+                         [&](const int line) {
+      const int n = line % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        if (line<NP) {
+          // d/dx along row n
+          dvv_line<false>(d, [&](const int k) { return scalar(n, k, ilev); },
+                             [&](const int j, const Scalar& y) { ds(0,n,j,ilev) = y * m_scale_factor_inv; });
+        } else {
+          // d/dy along column n
+          dvv_line<false>(d, [&](const int k) { return scalar(k, n, ilev); },
+                             [&](const int i, const Scalar& y) { ds(1,i,n,ilev) = y * m_scale_factor_inv; });
+        }
+      });
+    });
+    kv.team_barrier();
+
+    constexpr int np_squared = NP * NP;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        const auto& v0 = ds(0,igp,jgp,ilev);
+        const auto& v1 = ds(1,igp,jgp,ilev);
+        grad_s(0,igp,jgp,ilev) = D_inv(0,0,igp,jgp) * v0 + D_inv(0,1,igp,jgp) * v1;
+        grad_s(1,igp,jgp,ilev) = D_inv(1,0,igp,jgp) * v0 + D_inv(1,1,igp,jgp) * v1;
+      });
+    });
+    kv.team_barrier();
+  }
+
+  template<int NUM_LEV_OUT, typename InputProvider, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  gradient_sphere_gemm (const KernelVariables &kv,
+                        const InputProvider& scalar,
+                        const ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_OUT]>& grad_s) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    gradient_sphere_gemm<NUM_LEV_OUT, InputProvider>(kv, scalar, grad_s, NUM_LEV_REQUEST);
+  }
+
+  template<int NUM_LEV_OUT, typename InputProvider>
+  KOKKOS_INLINE_FUNCTION void
+  divergence_sphere_gemm (const KernelVariables &kv,
+                          const InputProvider& v,
+                          const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& div_v,
+                          const int NUM_LEV_REQUEST) const
+  {
+    assert(NUM_LEV_REQUEST>=0);
+    assert(NUM_LEV_REQUEST<=NUM_LEV_OUT);
+
+    // Make sure the buffers have been created
+    assert (vector_buf_ml.size()>0);
+
+    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& metdet = Homme::subview(m_metdet, kv.ie);
+    vector_buf<NUM_LEV_OUT> gv(Homme::subview(vector_buf_ml,kv.team_idx,0).data());
+    constexpr int np_squared = NP * NP;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        const auto& v0 = v(0, igp, jgp, ilev);
+        const auto& v1 = v(1, igp, jgp, ilev);
+        gv(0,igp,jgp,ilev) = (D_inv(0,0,igp,jgp) * v0 + D_inv(1,0,igp,jgp) * v1) * metdet(igp,jgp);
+        gv(1,igp,jgp,ilev) = (D_inv(0,1,igp,jgp) * v0 + D_inv(1,1,igp,jgp) * v1) * metdet(igp,jgp);
+      });
+    });
+    kv.team_barrier();
+
+    // du/dx along the rows, dv/dy along the columns, in place
+    Real d[NP][NP];
+    load_dvv(d);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, 2*NP),
+                         [&](const int line) {
+      const int n = line % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        if (line<NP) {
+          dvv_line<false>(d, [&](const int k) { return gv(0,n,k,ilev); },
+                             [&](const int j, const Scalar& y) { gv(0,n,j,ilev) = y; });
+        } else {
+          dvv_line<false>(d, [&](const int k) { return gv(1,k,n,ilev); },
+                             [&](const int i, const Scalar& y) { gv(1,i,n,ilev) = y; });
+        }
+      });
+    });
+    kv.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        div_v(igp,jgp,ilev) = (gv(0,igp,jgp,ilev) + gv(1,igp,jgp,ilev)) *
+                              (1.0 / metdet(igp, jgp) * m_scale_factor_inv);
+      });
+    });
+    kv.team_barrier();
+  }
+
+  template<int NUM_LEV_OUT, typename InputProvider, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  divergence_sphere_gemm (const KernelVariables &kv,
+                          const InputProvider& v,
+                          const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& div_v) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    divergence_sphere_gemm<NUM_LEV_OUT, InputProvider>(kv, v, div_v, NUM_LEV_REQUEST);
+  }
+
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  divergence_sphere_wk_gemm (const KernelVariables &kv,
+                             // On input, a field whose divergence is sought; on
+                             // output, the view's data are invalid.
+                             const ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_IN]>& v,
+                             const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& div_v,
+                             const int NUM_LEV_REQUEST) const
+  {
+    assert(NUM_LEV_REQUEST>=0);
+    assert(NUM_LEV_REQUEST<=NUM_LEV_IN);
+    assert(NUM_LEV_REQUEST<=NUM_LEV_OUT);
+
+    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& spheremp = Homme::subview(m_spheremp, kv.ie);
+    constexpr int np_squared = NP * NP;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        const auto v0 = v(0,igp,jgp,ilev);
+        const auto v1 = v(1,igp,jgp,ilev);
+        v(0,igp,jgp,ilev) = spheremp(igp,jgp) * (D_inv(0, 0, igp, jgp) * v0 + D_inv(1, 0, igp, jgp) * v1);
+        v(1,igp,jgp,ilev) = spheremp(igp,jgp) * (D_inv(0, 1, igp, jgp) * v0 + D_inv(1, 1, igp, jgp) * v1);
+      });
+    });
+    kv.team_barrier();
+
+    // The weak form applies dvv transposed: along the rows for the first
+    // component, along the columns for the second, in place
+    Real d[NP][NP];
+    load_dvv(d);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, 2*NP),
+                         [&](const int line) {
+      const int n = line % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        if (line<NP) {
+          dvv_line<true>(d, [&](const int k) { return v(0,n,k,ilev); },
+                            [&](const int m, const Scalar& y) { v(0,n,m,ilev) = y; });
+        } else {
+          dvv_line<true>(d, [&](const int k) { return v(1,k,n,ilev); },
+                            [&](const int m, const Scalar& y) { v(1,m,n,ilev) = y; });
+        }
+      });
+    });
+    kv.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        div_v(igp,jgp,ilev) = -(v(0,igp,jgp,ilev) + v(1,igp,jgp,ilev)) * m_scale_factor_inv;
+      });
+    });
+    kv.team_barrier();
+  }
+
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  divergence_sphere_wk_gemm (const KernelVariables &kv,
+                             const ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_IN]>& v,
+                             const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& div_v) const
+  {
+    divergence_sphere_wk_gemm<NUM_LEV_OUT, NUM_LEV_IN>(kv, v, div_v, NUM_LEV_REQUEST);
+  }
+
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  vorticity_sphere_gemm (const KernelVariables &kv,
+                         const typename ViewConst<ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_IN]>>::type& v,
+                         const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& vort,
+                         const int NUM_LEV_REQUEST) const
+  {
+    assert(NUM_LEV_REQUEST>=0);
+    assert(NUM_LEV_REQUEST<=NUM_LEV_IN);
+    assert(NUM_LEV_REQUEST<=NUM_LEV_OUT);
+
+    // Make sure the buffers have been created
+    assert (vector_buf_ml.size()>0);
+
+    const auto& D = Homme::subview(m_d, kv.ie);
+    const auto& metdet = Homme::subview(m_metdet, kv.ie);
+    vector_buf<NUM_LEV_OUT> vcov(Homme::subview(vector_buf_ml,kv.team_idx,0).data());
+    constexpr int np_squared = NP * NP;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        const auto& v0 = v(0,igp,jgp,ilev);
+        const auto& v1 = v(1,igp,jgp,ilev);
+        vcov(0,igp,jgp,ilev) = D(0,0,igp,jgp) * v0 + D(0,1,igp,jgp) * v1;
+        vcov(1,igp,jgp,ilev) = D(1,0,igp,jgp) * v0 + D(1,1,igp,jgp) * v1;
+      });
+    });
+    kv.team_barrier();
+
+    // dv/dx along the rows, du/dy along the columns, in place
+    Real d[NP][NP];
+    load_dvv(d);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, 2*NP),
+                         [&](const int line) {
+      const int n = line % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        if (line<NP) {
+          dvv_line<false>(d, [&](const int k) { return vcov(1,n,k,ilev); },
+                             [&](const int j, const Scalar& y) { vcov(1,n,j,ilev) = y; });
+        } else {
+          dvv_line<false>(d, [&](const int k) { return vcov(0,k,n,ilev); },
+                             [&](const int i, const Scalar& y) { vcov(0,i,n,ilev) = y; });
+        }
+      });
+    });
+    kv.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
+        vort(igp,jgp,ilev) = (vcov(1,igp,jgp,ilev) - vcov(0,igp,jgp,ilev)) *
+                             (1.0 / metdet(igp, jgp) * m_scale_factor_inv);
+      });
+    });
+    kv.team_barrier();
+  }
+
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  vorticity_sphere_gemm (const KernelVariables &kv,
+                         const typename ViewConst<ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_IN]>>::type& v,
+                         const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& vort) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_IN, "Error! Input view does not have enough levels.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    vorticity_sphere_gemm<NUM_LEV_OUT,NUM_LEV_IN>(kv, v, vort, NUM_LEV_REQUEST);
+  }
+
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  laplace_simple_gemm (const KernelVariables &kv,
+                       const typename ViewConst<ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_IN]>>::type& field,
+                       const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& laplace,
+                       const int NUM_LEV_REQUEST) const
+  {
+    assert(NUM_LEV_REQUEST<=NUM_LEV_IN);
+    assert(NUM_LEV_REQUEST<=NUM_LEV_OUT);
+
+    // Make sure the buffers have been created
+    assert (vector_buf_ml.size()>0);
+
+    vector_buf<NUM_LEV_OUT> grad_s(Homme::subview(vector_buf_ml, kv.team_idx, 0).data());
+    gradient_sphere_gemm<NUM_LEV_OUT,decltype(field)>(kv, field, grad_s, NUM_LEV_REQUEST);
+    divergence_sphere_wk_gemm<NUM_LEV_OUT,NUM_LEV_OUT>(kv, grad_s, laplace, NUM_LEV_REQUEST);
+  }
+
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  laplace_simple_gemm (const KernelVariables &kv,
+                       const typename ViewConst<ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_IN]>>::type& field,
+                       const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& laplace) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_IN, "Error! Input view does not have enough levels.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    laplace_simple_gemm<NUM_LEV_OUT,NUM_LEV_IN>(kv, field, laplace, NUM_LEV_REQUEST);
+  }
+
   // The buffers should be enough to handle any single call to any
   // single sphere operator.
   // One might prefer them to be private, but they are handy for
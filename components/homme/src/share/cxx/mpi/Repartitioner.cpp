@@ -0,0 +1,277 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#include "Repartitioner.hpp"
+#include "ErrorDefs.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+namespace Homme
+{
+
+Repartitioner::Repartitioner (std::shared_ptr<Connectivity> connectivity)
+ : m_connectivity (connectivity)
+ , m_any_moved (false)
+ , m_imbalance_before (1)
+ , m_imbalance_after (1)
+{
+  Errors::runtime_check(bool(m_connectivity),
+                        "Repartitioner: invalid connectivity pointer.");
+  Errors::runtime_check(m_connectivity->is_finalized(),
+                        "Repartitioner: the connectivity must be finalized.");
+  m_comm = m_connectivity->get_comm();
+  m_num_local = m_num_new_local = m_connectivity->get_num_local_elements();
+}
+
+std::vector<int> Repartitioner::split_curve (const std::vector<Real>& cost, const int nparts)
+{
+  const int n = cost.size();
+  const Real total = std::accumulate(cost.begin(), cost.end(), Real(0));
+
+  // Piece k starts at the first element whose midpoint, in cumulative cost, is
+  // past k*total/nparts.
+  std::vector<int> starts(nparts+1, n);
+  starts[0] = 0;
+  int k = 1;
+  Real sum = 0;
+  for (int i=0; i<n && k<nparts; ++i) {
+    while (k<nparts && sum + cost[i]/2 >= k*total/nparts) {
+      starts[k++] = i;
+    }
+    sum += cost[i];
+  }
+
+  // Don't leave pieces empty.
+  for (k=1; k<nparts; ++k) {
+    starts[k] = std::max(starts[k], std::min(starts[k-1]+1, n));
+  }
+  for (k=nparts-1; k>0; --k) {
+    starts[k] = std::max(0, std::min(starts[k], starts[k+1]-1));
+  }
+  return starts;
+}
+
+void Repartitioner::compute (const std::vector<Real>& cost, const Method method)
+{
+  Errors::runtime_check(static_cast<int>(cost.size())==m_num_local,
+                        "Repartitioner::compute: cost must have one entry per local element.");
+
+  const auto comm = m_comm.mpi_comm();
+  const int nranks = m_comm.size();
+  const int rank = m_comm.rank();
+
+  // Gather the elements data in curve order.
+  std::vector<int> counts(nranks), offsets(nranks+1, 0);
+  MPI_Allgather(&m_num_local, 1, MPI_INT, counts.data(), 1, MPI_INT, comm);
+  for (int p=0; p<nranks; ++p) {
+    offsets[p+1] = offsets[p] + counts[p];
+  }
+  const int nglobal = offsets[nranks];
+
+  std::vector<Real> gcost(nglobal);
+  MPI_Allgatherv(cost.data(), m_num_local, MPI_DOUBLE,
+                 gcost.data(), counts.data(), offsets.data(), MPI_DOUBLE, comm);
+
+  const auto h_ucon = m_connectivity->get_h_ucon();
+  const auto h_ucon_ptr = m_connectivity->get_h_ucon_ptr();
+  std::vector<int> gid(m_num_local);
+  for (int ie=0; ie<m_num_local; ++ie) {
+    gid[ie] = h_ucon(h_ucon_ptr(ie)).local.gid;
+  }
+  m_gid.resize(nglobal);
+  MPI_Allgatherv(gid.data(), m_num_local, MPI_INT,
+                 m_gid.data(), counts.data(), offsets.data(), MPI_INT, comm);
+
+  std::vector<Real> loads(nranks, 0);
+  for (int p=0; p<nranks; ++p) {
+    for (int i=offsets[p]; i<offsets[p+1]; ++i) {
+      loads[p] += gcost[i];
+    }
+  }
+
+  // New owners.
+  m_new_owner_local.resize(m_num_local);
+  if (method==Method::SFC) {
+    const auto starts = split_curve(gcost, nranks);
+    for (int ie=0; ie<m_num_local; ++ie) {
+      const int i = offsets[rank] + ie;
+      m_new_owner_local[ie] = std::upper_bound(starts.begin(), starts.end()-1, i) - starts.begin() - 1;
+    }
+  } else {
+    compute_graph_owners(cost, loads, m_new_owner_local);
+  }
+  m_new_owner.resize(nglobal);
+  MPI_Allgatherv(m_new_owner_local.data(), m_num_local, MPI_INT,
+                 m_new_owner.data(), counts.data(), offsets.data(), MPI_INT, comm);
+
+  // Never make the max load worse: if the new partition does, keep the
+  // current one. All processes have the same data, so they agree on this.
+  std::vector<Real> new_loads(nranks, 0);
+  for (int i=0; i<nglobal; ++i) {
+    new_loads[m_new_owner[i]] += gcost[i];
+  }
+  if (*std::max_element(new_loads.begin(), new_loads.end()) >
+      *std::max_element(loads.begin(), loads.end())) {
+    for (int p=0; p<nranks; ++p) {
+      std::fill(m_new_owner.begin()+offsets[p], m_new_owner.begin()+offsets[p+1], p);
+    }
+    m_new_owner_local.assign(m_num_local, rank);
+    new_loads = loads;
+  }
+
+  // New local ids follow the curve order on each process.
+  std::vector<int> new_counts(nranks, 0);
+  m_new_lid.resize(nglobal);
+  m_any_moved = false;
+  for (int p=0; p<nranks; ++p) {
+    for (int i=offsets[p]; i<offsets[p+1]; ++i) {
+      const int q = m_new_owner[i];
+      m_new_lid[i] = new_counts[q]++;
+      m_any_moved = m_any_moved || q!=p;
+    }
+  }
+  m_num_new_local = new_counts[rank];
+
+  // Send plan.
+  m_send_count.assign(nranks, 0);
+  for (int ie=0; ie<m_num_local; ++ie) {
+    ++m_send_count[m_new_owner_local[ie]];
+  }
+  std::vector<int> send_offsets(nranks+1, 0);
+  for (int p=0; p<nranks; ++p) {
+    send_offsets[p+1] = send_offsets[p] + m_send_count[p];
+  }
+  m_send_lids.resize(m_num_local);
+  for (int ie=0; ie<m_num_local; ++ie) {
+    m_send_lids[send_offsets[m_new_owner_local[ie]]++] = ie;
+  }
+
+  const Real mean = std::accumulate(loads.begin(), loads.end(), Real(0)) / nranks;
+  if (mean > 0) {
+    m_imbalance_before = *std::max_element(loads.begin(), loads.end()) / mean;
+    m_imbalance_after  = *std::max_element(new_loads.begin(), new_loads.end()) / mean;
+  }
+}
+
+void Repartitioner::compute_graph_owners (const std::vector<Real>& cost,
+                                          const std::vector<Real>& loads,
+                                          std::vector<int>& owner) const
+{
+  const int nranks = m_comm.size();
+  const int rank = m_comm.rank();
+  const auto h_ucon = m_connectivity->get_h_ucon();
+  const auto h_ucon_ptr = m_connectivity->get_h_ucon_ptr();
+
+  // Neighbors in the process graph, and the local elements on the boundary
+  // with each of them.
+  std::vector<std::vector<int>> boundary(nranks);
+  for (int ie=0; ie<m_num_local; ++ie) {
+    for (int k=h_ucon_ptr(ie); k<h_ucon_ptr(ie+1); ++k) {
+      const auto& info = h_ucon(k);
+      if (info.sharing!=etoi(ConnectionSharing::SHARED)) continue;
+      auto& b = boundary[info.remote_pid];
+      if (b.empty() || b.back()!=ie) {
+        b.push_back(ie);
+      }
+    }
+  }
+  int degree = 0;
+  for (const auto& b : boundary) {
+    degree += b.empty() ? 0 : 1;
+  }
+  std::vector<int> degrees(nranks);
+  MPI_Allgather(&degree, 1, MPI_INT, degrees.data(), 1, MPI_INT, m_comm.mpi_comm());
+
+  // One step of diffusion: send (L_i - L_j)/(1 + max(d_i,d_j)) to each less
+  // loaded neighbor j, using elements on the boundary with j. Each process
+  // keeps at least one element.
+  owner.assign(m_num_local, rank);
+  int num_kept = m_num_local;
+  for (int p=0; p<nranks; ++p) {
+    if (boundary[p].empty() || loads[p]>=loads[rank]) continue;
+    const Real flow = (loads[rank] - loads[p]) / (1 + std::max(degree, degrees[p]));
+    Real moved = 0;
+    for (const int ie : boundary[p]) {
+      if (num_kept==1) break;
+      if (owner[ie]!=rank || moved + cost[ie] > flow) continue;
+      owner[ie] = p;
+      moved += cost[ie];
+      --num_kept;
+    }
+  }
+}
+
+void Repartitioner::alltoallv (const std::vector<char>& send, const std::vector<int>& send_bytes,
+                               std::vector<char>& recv) const
+{
+  const auto comm = m_comm.mpi_comm();
+  const int nranks = m_comm.size();
+
+  std::vector<int> recv_bytes(nranks);
+  MPI_Alltoall(send_bytes.data(), 1, MPI_INT, recv_bytes.data(), 1, MPI_INT, comm);
+
+  std::vector<int> send_displs(nranks, 0), recv_displs(nranks, 0);
+  for (int p=1; p<nranks; ++p) {
+    send_displs[p] = send_displs[p-1] + send_bytes[p-1];
+    recv_displs[p] = recv_displs[p-1] + recv_bytes[p-1];
+  }
+  recv.resize(recv_displs[nranks-1] + recv_bytes[nranks-1]);
+  MPI_Alltoallv(send.data(), send_bytes.data(), send_displs.data(), MPI_BYTE,
+                recv.data(), recv_bytes.data(), recv_displs.data(), MPI_BYTE, comm);
+}
+
+void Repartitioner::build_connectivity (Connectivity& conn) const
+{
+  // The connection data the new owner needs, sent along with each element.
+  struct Record {
+    int l_gid, r_gid;
+    std::uint8_t l_dir, l_dir_idx, r_dir, r_dir_idx;
+  };
+
+  const int nranks = m_comm.size();
+  const int rank = m_comm.rank();
+  const auto h_ucon = m_connectivity->get_h_ucon();
+  const auto h_ucon_ptr = m_connectivity->get_h_ucon_ptr();
+
+  std::vector<Record> records;
+  std::vector<int> send_bytes(nranks, 0);
+  for (const int ie : m_send_lids) {
+    for (int k=h_ucon_ptr(ie); k<h_ucon_ptr(ie+1); ++k) {
+      const auto& info = h_ucon(k);
+      records.push_back(Record{info.local.gid, info.remote.gid,
+                               info.local.dir, info.local.dir_idx,
+                               info.remote.dir, info.remote.dir_idx});
+      send_bytes[m_new_owner_local[ie]] += sizeof(Record);
+    }
+  }
+  std::vector<char> send(records.size()*sizeof(Record)), recv;
+  std::memcpy(send.data(), records.data(), send.size());
+  alltoallv(send, send_bytes, recv);
+
+  // Map gids to positions along the curve.
+  const int max_gid = m_gid.empty() ? 0 : *std::max_element(m_gid.begin(), m_gid.end());
+  std::vector<int> pos(max_gid+1, -1);
+  for (size_t i=0; i<m_gid.size(); ++i) {
+    pos[m_gid[i]] = i;
+  }
+
+  conn.set_comm(m_comm);
+  conn.set_num_elements(m_num_new_local);
+  conn.set_max_corner_elements(m_connectivity->get_max_corner_elements());
+  const int nrecv = recv.size()/sizeof(Record);
+  for (int i=0; i<nrecv; ++i) {
+    Record r;
+    std::memcpy(&r, recv.data() + i*sizeof(Record), sizeof(Record));
+    const int il = pos[r.l_gid], ir = pos[r.r_gid];
+    conn.add_connection(m_new_lid[il], r.l_gid, r.l_dir, r.l_dir_idx, rank,
+                        m_new_lid[ir], r.r_gid, r.r_dir, r.r_dir_idx, m_new_owner[ir]);
+  }
+  conn.finalize();
+}
+
+} // namespace Homme
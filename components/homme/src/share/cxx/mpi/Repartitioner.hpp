@@ -0,0 +1,173 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_REPARTITIONER_HPP
+#define HOMMEXX_REPARTITIONER_HPP
+
+#include "Comm.hpp"
+#include "Connectivity.hpp"
+#include "Types.hpp"
+#include "ErrorDefs.hpp"
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Homme
+{
+
+/*
+ * A class to rebalance the elements across processes, based on a measured
+ * cost per element (e.g., physics column timings, or DIRK iteration counts).
+ *
+ * Elements are ordered along a curve: element ie on process p comes after all
+ * the elements on processes q<p, and after elements 0,...,ie-1 on process p.
+ * With the default space filling curve partition, this is the SFC order. The
+ * new partition keeps the elements of each process in curve order, and the
+ * SFC method keeps the partition contiguous along the curve, so SFC
+ * repartitions can be repeated during the run. A partition is never replaced
+ * by one with a larger max load.
+ *
+ * Limitation: the curve is only known through the (process, local id) order.
+ * A Method::Graph step moves elements to neighboring processes, which number
+ * them along with their own elements, so the order of the new partition is no
+ * longer the SFC order. Later SFC steps still produce a valid, balanced
+ * partition, but contiguous along this new order rather than along the SFC.
+ *
+ * Usage:
+ *   Repartitioner rp(connectivity);
+ *   rp.compute(cost, Repartitioner::Method::SFC);
+ *   if (rp.imbalance_after() < 0.9*rp.imbalance_before()) {
+ *     rp.migrate(view);    // For each view storing per-element data
+ *     rp.build_connectivity(new_connectivity);
+ *   }
+ * BoundaryExchange objects must then be given the new connectivity, and have
+ * their fields registered again.
+ */
+class Repartitioner
+{
+public:
+
+  enum class Method {
+    SFC,    // Cut the curve in contiguous pieces of (nearly) equal cost
+    Graph   // Diffuse cost from each process to its neighbors in the element graph
+  };
+
+  Repartitioner (std::shared_ptr<Connectivity> connectivity);
+
+  // Compute the new partition. cost(ie) is the cost of local element ie. This
+  // call is collective. With Method::Graph, each call does one diffusion step,
+  // so that the data movement stays local to neighboring processes.
+  void compute (const std::vector<Real>& cost, const Method method);
+
+  // Ratio of max to mean cost per process, before and after the repartition.
+  // imbalance_after() is never larger than imbalance_before().
+  Real imbalance_before () const { return m_imbalance_before; }
+  Real imbalance_after  () const { return m_imbalance_after;  }
+
+  // Number of elements owned by this process after the repartition.
+  int num_new_local_elements () const { return m_num_new_local; }
+
+  // New owner of each current local element.
+  const std::vector<int>& get_new_owners () const { return m_new_owner_local; }
+
+  // Whether any element, on any process, changes owner.
+  bool any_moved () const { return m_any_moved; }
+
+  // Move per-element data to the new owners. The first dimension of v must be
+  // the local element, and must be the only runtime dimension. On output, v
+  // is a new view with num_new_local_elements() elements. Collective.
+  template <typename ViewT>
+  void migrate (ViewT& v) const;
+
+  // Set up conn for the new partition, from the connections of the current
+  // one. conn must not be initialized yet. Collective.
+  void build_connectivity (Connectivity& conn) const;
+
+  // Cut a sequence of elements with the given costs into nparts contiguous
+  // pieces of nearly equal cost. Return the index of the first element of
+  // each piece, followed by the number of elements. Each piece has at least
+  // one element, if there are enough elements.
+  static std::vector<int> split_curve (const std::vector<Real>& cost, const int nparts);
+
+private:
+
+  // Send send_bytes[p] bytes from send to process p. On output, recv stores
+  // the bytes received from each process, in process order.
+  void alltoallv (const std::vector<char>& send, const std::vector<int>& send_bytes,
+                  std::vector<char>& recv) const;
+
+  void compute_graph_owners (const std::vector<Real>& cost, const std::vector<Real>& loads,
+                             std::vector<int>& owner) const;
+
+  std::shared_ptr<Connectivity> m_connectivity;
+  Comm m_comm;
+
+  int m_num_local;
+  int m_num_new_local;
+  bool m_any_moved;
+  Real m_imbalance_before;
+  Real m_imbalance_after;
+
+  // Data of all elements, in curve order
+  std::vector<int> m_gid;
+  std::vector<int> m_new_owner;
+  std::vector<int> m_new_lid;
+
+  // Data of the current local elements
+  std::vector<int> m_new_owner_local;
+  // Local ids of the elements to send, sorted by destination process, and the
+  // number of elements sent to each process.
+  std::vector<int> m_send_lids;
+  std::vector<int> m_send_count;
+};
+
+template <typename ViewT>
+void Repartitioner::migrate (ViewT& v) const
+{
+  static_assert(std::is_same<typename ViewT::array_layout, Kokkos::LayoutRight>::value,
+                "Error! Repartitioner::migrate requires LayoutRight views.\n");
+  static_assert(ViewT::rank_dynamic==1,
+                "Error! Repartitioner::migrate requires the element to be the only runtime dimension.\n");
+  Errors::runtime_check(v.extent_int(0)==m_num_local,
+                        "Repartitioner::migrate: the view extent must be the number of local elements.");
+
+  using value_type = typename ViewT::non_const_value_type;
+  size_t elem_size = 1;
+  for (unsigned r=1; r<ViewT::rank; ++r) {
+    elem_size *= v.extent(r);
+  }
+  const size_t elem_bytes = elem_size*sizeof(value_type);
+
+  const auto v_h = Kokkos::create_mirror_view(v);
+  Kokkos::deep_copy(v_h, v);
+
+  // Elements are stored in m_send_lids in the order in which the destination
+  // stores them, so the received bytes are the new view, as they are.
+  std::vector<char> send(m_send_lids.size()*elem_bytes);
+  for (size_t i=0; i<m_send_lids.size(); ++i) {
+    std::memcpy(send.data() + i*elem_bytes, v_h.data() + m_send_lids[i]*elem_size, elem_bytes);
+  }
+  std::vector<int> send_bytes(m_send_count.size());
+  for (size_t p=0; p<m_send_count.size(); ++p) {
+    send_bytes[p] = m_send_count[p]*elem_bytes;
+  }
+  std::vector<char> recv;
+  alltoallv(send, send_bytes, recv);
+  Errors::runtime_check(recv.size()==m_num_new_local*elem_bytes,
+                        "Repartitioner::migrate: received data does not match the new number of local elements.");
+
+  ViewT nv(v.label(), m_num_new_local);
+  const auto nv_h = Kokkos::create_mirror_view(nv);
+  std::memcpy(nv_h.data(), recv.data(), recv.size());
+  Kokkos::deep_copy(nv, nv_h);
+  v = nv;
+}
+
+} // namespace Homme
+
+#endif // HOMMEXX_REPARTITIONER_HPP
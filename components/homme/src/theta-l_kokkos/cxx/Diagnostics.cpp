@@ -8,11 +8,17 @@
 #include "TimeLevel.hpp"
 #include "Tracers.hpp"
 
+#include "mpi/Connectivity.hpp"
+
 #include "utilities/SyncUtils.hpp"
 #include "utilities/SubviewUtils.hpp"
 
 #include "profiling.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
 namespace Homme
 {
 
@@ -57,6 +63,9 @@ void Diagnostics::init (const ElementsState& state, const ElementsGeometry& geom
   d_IEner  = decltype(d_IEner) ("Internal  Energy", m_num_elems);
   d_KEner  = decltype(d_KEner) ("Kinetic   Energy", m_num_elems);
   d_PEner  = decltype(d_PEner) ("Potential Energy", m_num_elems);
+
+  m_point_integrals = decltype(m_point_integrals)("Point integrals",   m_num_elems, num_global_integrals());
+  m_elem_integrals  = decltype(m_elem_integrals) ("Element integrals", num_global_integrals(), m_num_elems);
 }
 
 int Diagnostics::requested_buffer_size () const {
@@ -143,6 +152,26 @@ void Diagnostics::prim_energy_halftimes (const bool before_advance, const int iv
 {
   m_ivar = ivar;
 
+  set_time_levels(before_advance);
+
+  Kokkos::parallel_for(m_policy_energy_halftimes, *this);
+}
+
+void Diagnostics::compute_global_integrals (const bool before_advance, Real* integrals,
+                                            const bool reproducible)
+{
+  GPTLstart("prim_diag_global_integrals");
+  set_time_levels(before_advance);
+
+  Kokkos::parallel_for(m_policy_global_integrals, *this);
+
+  sum_element_integrals(m_elem_integrals, integrals, reproducible,
+                        Context::singleton().get<Connectivity>().get_comm().mpi_comm());
+  GPTLstop("prim_diag_global_integrals");
+}
+
+void Diagnostics::set_time_levels (const bool before_advance)
+{
   // Get simulation params
   SimulationParams& params = Context::singleton().get<SimulationParams>();
   assert(params.params_set);
@@ -161,8 +190,96 @@ void Diagnostics::prim_energy_halftimes (const bool before_advance, const int iv
     t1 = tl.np1;
     t1_qdp = tl.np1_qdp;
   }
+}
 
-  Kokkos::parallel_for(m_policy_energy_halftimes, *this);
+void Diagnostics::
+sum_element_integrals (const ExecViewUnmanaged<const Real**>& elem_integrals,
+                       Real* integrals, const bool reproducible, const MPI_Comm& mpi_comm)
+{
+  using TeamPolicy = Kokkos::TeamPolicy<ExecSpace>;
+  using Member = TeamPolicy::member_type;
+
+  const int nfld  = elem_integrals.extent_int(0);
+  const int nelem = elem_integrals.extent_int(1);
+
+  if ( ! reproducible) {
+    // Local sums on device, then one allreduce of all the integrals.
+    ExecViewManaged<Real*> sums("Local integrals", nfld);
+    Kokkos::parallel_for(TeamPolicy(nfld, Kokkos::AUTO), KOKKOS_LAMBDA (const Member& team) {
+      const int ifld = team.league_rank();
+      Real sum;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, nelem),
+                              [&](const int ie, Real& accumulator) {
+        accumulator += elem_integrals(ifld,ie);
+      }, sum);
+      Kokkos::single(Kokkos::PerTeam(team),[&](){ sums(ifld) = sum; });
+    });
+    std::vector<Real> local(nfld);
+    Kokkos::deep_copy(HostViewUnmanaged<Real*>(local.data(), nfld), sums);
+    MPI_Allreduce(local.data(), integrals, nfld, MPI_DOUBLE, MPI_SUM, mpi_comm);
+    return;
+  }
+
+  // Reproducible sum. Each element integral is split into ndigit integers,
+  // each holding nbits bits of the value, relative to the largest element
+  // integral of that field across all ranks. Integer sums are exact, hence
+  // associative, so the result does not depend on how the elements are
+  // distributed or summed. nbits leaves room for 2^(62-nbits) elements.
+  constexpr int ndigit = 3;
+  constexpr int nbits  = 36;
+
+  ExecViewManaged<Real*> maxes("Max element integrals", nfld);
+  Kokkos::parallel_for(TeamPolicy(nfld, Kokkos::AUTO), KOKKOS_LAMBDA (const Member& team) {
+    const int ifld = team.league_rank();
+    Real max;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, nelem),
+                            [&](const int ie, Real& m) {
+      const Real a = Kokkos::abs(elem_integrals(ifld,ie));
+      if (a > m) m = a;
+    }, Kokkos::Max<Real>(max));
+    Kokkos::single(Kokkos::PerTeam(team),[&](){ maxes(ifld) = max; });
+  });
+  std::vector<Real> local_max(nfld), global_max(nfld);
+  Kokkos::deep_copy(HostViewUnmanaged<Real*>(local_max.data(), nfld), maxes);
+  MPI_Allreduce(local_max.data(), global_max.data(), nfld, MPI_DOUBLE, MPI_MAX, mpi_comm);
+
+  // The element integrals of field ifld, scaled by 2^-exps(ifld), are in (-1,1).
+  ExecViewManaged<int*> exps("Integral exponents", nfld);
+  const auto exps_h = Kokkos::create_mirror_view(exps);
+  for (int ifld=0; ifld<nfld; ++ifld) {
+    std::frexp(global_max[ifld], &exps_h(ifld));
+  }
+  Kokkos::deep_copy(exps, exps_h);
+
+  ExecViewManaged<std::int64_t*> digits("Integral digits", nfld*ndigit);
+  Kokkos::parallel_for(TeamPolicy(nfld*ndigit, Kokkos::AUTO), KOKKOS_LAMBDA (const Member& team) {
+    const int ifld = team.league_rank() / ndigit;
+    const int idig = team.league_rank() % ndigit;
+    std::int64_t sum;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, nelem),
+                            [&](const int ie, std::int64_t& accumulator) {
+      // Peel off the leading digits. All operations are exact.
+      Real x = ldexp(elem_integrals(ifld,ie), -exps(ifld));
+      Real d = 0;
+      for (int i=0; i<=idig; ++i) {
+        x = ldexp(x - d, nbits);
+        d = trunc(x);
+      }
+      accumulator += static_cast<std::int64_t>(d);
+    }, sum);
+    Kokkos::single(Kokkos::PerTeam(team),[&](){ digits(team.league_rank()) = sum; });
+  });
+  std::vector<std::int64_t> local_digits(nfld*ndigit), global_digits(nfld*ndigit);
+  Kokkos::deep_copy(HostViewUnmanaged<std::int64_t*>(local_digits.data(), nfld*ndigit), digits);
+  MPI_Allreduce(local_digits.data(), global_digits.data(), nfld*ndigit, MPI_INT64_T, MPI_SUM, mpi_comm);
+
+  for (int ifld=0; ifld<nfld; ++ifld) {
+    Real sum = 0;
+    for (int idig=ndigit-1; idig>=0; --idig) {
+      sum = std::ldexp(sum, -nbits) + static_cast<Real>(global_digits[ifld*ndigit+idig]);
+    }
+    integrals[ifld] = std::ldexp(sum, exps_h(ifld)-nbits);
+  }
 }
 
 } // namespace Homme
@@ -14,6 +14,8 @@
 #include "utilities/SubviewUtils.hpp"
 #include "utilities/ViewUtils.hpp"
 
+#include <mpi.h>
+
 #if ! defined(NDEBUG)
 #define RESOLVE_ISSUE_WITH_ASSERTS
 #endif
@@ -70,9 +72,11 @@ public:
 #if ! defined(RESOLVE_ISSUE_WITH_ASSERTS)
     m_policy_diag_scalars(Homme::get_default_team_policy<ExecSpace,DiagScalarsTag>(num_elems*num_tracers)),
     m_policy_energy_halftimes(Homme::get_default_team_policy<ExecSpace,EnergyHalfTimesTag>(num_elems)),
+    m_policy_global_integrals(Homme::get_default_team_policy<ExecSpace,GlobalIntegralsTag>(num_elems)),
 #else
     m_policy_diag_scalars(d_team_policy<DiagScalarsTag>(num_elems*num_tracers)),
     m_policy_energy_halftimes(d_team_policy<EnergyHalfTimesTag>(num_elems)),
+    m_policy_global_integrals(d_team_policy<GlobalIntegralsTag>(num_elems)),
 #endif
     m_tu(m_policy_energy_halftimes),
     m_num_elems(num_elems),
@@ -97,8 +101,37 @@ public:
   void prim_diag_scalars (const bool before_advance, const int ivar);
   void prim_energy_halftimes (const bool before_advance, const int ivar);
 
+  // Indices of the global integrals computed by compute_global_integrals.
+  // The mass of each tracer follows, at index num_fixed_integrals+iq.
+  enum : int {
+    KE_INTEGRAL   = 0,  // Kinetic energy
+    IE_INTEGRAL   = 1,  // Internal energy
+    PE_INTEGRAL   = 2,  // Potential energy
+    DP_INTEGRAL   = 3,  // Air mass (times g)
+    num_fixed_integrals = 4
+  };
+
+  int num_global_integrals () const { return num_fixed_integrals + m_num_tracers; }
+
+  // Compute the area-weighted global integrals of energies, air mass and tracer
+  // masses, at the time level that run_diagnostics would use. All integrals are
+  // computed in one kernel and reduced across ranks with one batched
+  // allreduce. If reproducible is true, the result does not depend on the
+  // domain decomposition nor on the order of the sums. The output is stored in
+  // integrals, which must have num_global_integrals() entries on all ranks.
+  void compute_global_integrals (const bool before_advance, Real* integrals,
+                                 const bool reproducible = false);
+
+  // Sum elem_integrals(ifld,ie) over the elements of all ranks in mpi_comm,
+  // and store the sum of each ifld in integrals. The reproducible sum gives
+  // the same bits for any distribution and ordering of the elements.
+  static void sum_element_integrals (const ExecViewUnmanaged<const Real**>& elem_integrals,
+                                     Real* integrals, const bool reproducible,
+                                     const MPI_Comm& mpi_comm);
+
   struct DiagScalarsTag {};
   struct EnergyHalfTimesTag {};
+  struct GlobalIntegralsTag {};
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const DiagScalarsTag&, const TeamMember& team) const {
@@ -141,14 +174,92 @@ public:
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const EnergyHalfTimesTag&, const TeamMember& team) const {
+    KernelVariables kv(team, m_tu);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
+                         [&](const int &point_idx) {
+      const int igp = point_idx / NP;
+      const int jgp = point_idx % NP;
+
+      compute_energies(kv,igp,jgp,d_KEner(kv.ie,m_ivar,igp,jgp),
+                                  d_PEner(kv.ie,m_ivar,igp,jgp),
+                                  d_IEner(kv.ie,m_ivar,igp,jgp));
+    });
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const GlobalIntegralsTag&, const TeamMember& team) const {
+    KernelVariables kv(team, m_tu);
+
+    const auto all = Kokkos::ALL();
+    const auto point_integrals = Kokkos::subview(m_point_integrals,kv.ie,all,all,all);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
+                         [&](const int &point_idx) {
+      const int igp = point_idx / NP;
+      const int jgp = point_idx % NP;
+
+      Real KEner, PEner, IEner;
+      compute_energies(kv,igp,jgp,KEner,PEner,IEner);
+
+      const auto dpt1 = viewAsReal(Homme::subview(m_state.m_dp3d,kv.ie,t1,igp,jgp));
+      Real dp;
+      Dispatch<>::parallel_reduce(kv.team, Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                                  [&](const int ilev, Real& accumulator){
+        accumulator += dpt1(ilev);
+      }, dp);
+
+      const Real w = m_geometry.m_spheremp(kv.ie,igp,jgp);
+      Kokkos::single(Kokkos::PerThread(kv.team),[&](){
+        point_integrals(KE_INTEGRAL,igp,jgp) = w*KEner;
+        point_integrals(IE_INTEGRAL,igp,jgp) = w*IEner;
+        point_integrals(PE_INTEGRAL,igp,jgp) = w*PEner;
+        point_integrals(DP_INTEGRAL,igp,jgp) = w*dp;
+      });
+
+      for (int iq=0; iq<m_num_tracers; ++iq) {
+        const auto qdp = viewAsReal(Homme::subview(m_tracers.qdp,kv.ie,t1_qdp,iq,igp,jgp));
+        Real qmass;
+        Dispatch<>::parallel_reduce(kv.team, Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                                    [&](const int ilev, Real& accumulator){
+          accumulator += qdp(ilev);
+        }, qmass);
+        Kokkos::single(Kokkos::PerThread(kv.team),[&](){
+          point_integrals(num_fixed_integrals+iq,igp,jgp) = w*qmass;
+        });
+      }
+    });
+    kv.team_barrier();
+
+    // Sum over the points in a fixed order, so that the element integrals
+    // do not depend on the team configuration.
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, num_global_integrals()),
+                         [&](const int ifld) {
+      Kokkos::single(Kokkos::PerThread(kv.team),[&](){
+        Real sum = 0;
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            sum += point_integrals(ifld,igp,jgp);
+          }
+        }
+        m_elem_integrals(ifld,kv.ie) = sum;
+      });
+    });
+  }
+
+private:
+
+  // Compute the column integrals of kinetic, potential and internal energy
+  // at point (igp,jgp) of element kv.ie, at time level t1.
+  KOKKOS_INLINE_FUNCTION
+  void compute_energies (const KernelVariables& kv, const int igp, const int jgp,
+                         Real& KEner, Real& PEner, Real& IEner) const {
     // This checks that the buffers were init-ed (debug only)
     assert (m_buffers.phi.size()>0);
     assert (m_buffers.exner.size()>0);
     assert (m_buffers.pnh.size()>0);
     assert (m_buffers.dpnh_dp_i.size()>0);
 
-    KernelVariables kv(team, m_tu);
-
     // Subview inputs/outputs
     auto vtheta_dp = Homme::subview(m_state.m_vtheta_dp, kv.ie,t1);
     auto dpt1      = Homme::subview(m_state.m_dp3d,      kv.ie,t1);
@@ -159,95 +270,84 @@ public:
     auto phi       = Homme::subview(m_buffers.phi,       kv.team_idx);
     auto exner     = Homme::subview(m_buffers.exner,     kv.team_idx);
     auto pnh       = Homme::subview(m_buffers.pnh,       kv.team_idx);
-    auto dpnh_dp_i = Homme::subview(m_buffers.dpnh_dp_i, kv.team_idx);
-
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
-                         [&](const int &point_idx) {
-      const int igp = point_idx / NP;
-      const int jgp = point_idx % NP;
 
-      // Reinterpret everything as Real* instead of Scalar*.
-      // Give up some vectorization on CPU, but diagnostics are not a performance sensitive part
-      auto u              = viewAsReal(Homme::subview(m_state.m_v,kv.ie,t1,0,igp,jgp));
-      auto v              = viewAsReal(Homme::subview(m_state.m_v,kv.ie,t1,1,igp,jgp));
-      auto pnh_real       = viewAsReal(Homme::subview(pnh,igp,jgp));
-      auto phi_real       = viewAsReal(Homme::subview(phi,igp,jgp));
-      auto dpt1_real      = viewAsReal(Homme::subview(dpt1,igp,jgp));
-      auto phi_i_real     = viewAsReal(Homme::subview(phi_i,igp,jgp));
-      auto vtheta_dp_real = viewAsReal(Homme::subview(vtheta_dp,igp,jgp));
-      auto exner_real     = viewAsReal(Homme::subview(exner,igp,jgp));
-
-      // Compute exner and pnh
-      if (m_theta_hydrostatic_mode) {
-        // Use phi_i to store the temporary p_i
-        m_elem_ops.compute_hydrostatic_p(kv,Homme::subview(dpt1,igp,jgp),
-                                            Homme::subview(phi_i,igp,jgp),
-                                            Homme::subview(pnh,igp,jgp));
-        m_eos.compute_exner(kv,Homme::subview(pnh,igp,jgp),
-                               Homme::subview(exner,igp,jgp));
-
-        m_eos.compute_phi_i(kv,m_geometry.m_phis(kv.ie,igp,jgp),
-                               Homme::subview(vtheta_dp,igp,jgp),
-                               Homme::subview(exner,igp,jgp),
-                               Homme::subview(pnh,igp,jgp),
-                               Homme::subview(phi_i,igp,jgp));
-      } else {
-        m_eos.compute_pnh_and_exner(kv,Homme::subview(vtheta_dp,igp,jgp),
-                                       Homme::subview(phi_i,igp,jgp),
-                                       Homme::subview(pnh,igp,jgp),
-                                       Homme::subview(exner,igp,jgp));
-      }
-
-      // Compute phi at midpoints
-      ColumnOps::compute_midpoint_values(kv,Homme::subview(phi_i,igp,jgp),
-                                            Homme::subview(phi,  igp,jgp));
-
-      auto& KEner = d_KEner(kv.ie,m_ivar,igp,jgp);
-      auto& PEner = d_PEner(kv.ie,m_ivar,igp,jgp);
-      auto& IEner = d_IEner(kv.ie,m_ivar,igp,jgp);
+    // Reinterpret everything as Real* instead of Scalar*.
+    // Give up some vectorization on CPU, but diagnostics are not a performance sensitive part
+    auto u              = viewAsReal(Homme::subview(m_state.m_v,kv.ie,t1,0,igp,jgp));
+    auto v              = viewAsReal(Homme::subview(m_state.m_v,kv.ie,t1,1,igp,jgp));
+    auto pnh_real       = viewAsReal(Homme::subview(pnh,igp,jgp));
+    auto phi_real       = viewAsReal(Homme::subview(phi,igp,jgp));
+    auto dpt1_real      = viewAsReal(Homme::subview(dpt1,igp,jgp));
+    auto phi_i_real     = viewAsReal(Homme::subview(phi_i,igp,jgp));
+    auto vtheta_dp_real = viewAsReal(Homme::subview(vtheta_dp,igp,jgp));
+    auto exner_real     = viewAsReal(Homme::subview(exner,igp,jgp));
+
+    // Compute exner and pnh
+    if (m_theta_hydrostatic_mode) {
+      // Use phi_i to store the temporary p_i
+      m_elem_ops.compute_hydrostatic_p(kv,Homme::subview(dpt1,igp,jgp),
+                                          Homme::subview(phi_i,igp,jgp),
+                                          Homme::subview(pnh,igp,jgp));
+      m_eos.compute_exner(kv,Homme::subview(pnh,igp,jgp),
+                             Homme::subview(exner,igp,jgp));
+
+      m_eos.compute_phi_i(kv,m_geometry.m_phis(kv.ie,igp,jgp),
+                             Homme::subview(vtheta_dp,igp,jgp),
+                             Homme::subview(exner,igp,jgp),
+                             Homme::subview(pnh,igp,jgp),
+                             Homme::subview(phi_i,igp,jgp));
+    } else {
+      m_eos.compute_pnh_and_exner(kv,Homme::subview(vtheta_dp,igp,jgp),
+                                     Homme::subview(phi_i,igp,jgp),
+                                     Homme::subview(pnh,igp,jgp),
+                                     Homme::subview(exner,igp,jgp));
+    }
+
+    // Compute phi at midpoints
+    ColumnOps::compute_midpoint_values(kv,Homme::subview(phi_i,igp,jgp),
+                                          Homme::subview(phi,  igp,jgp));
+
+    // Compute KEner
+    KEner = 0.0;
+    Dispatch<>::parallel_reduce(kv.team, Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                                [&](const int ilev, Real& accumulator){
+      accumulator += ((u(ilev)*u(ilev) + v(ilev)*v(ilev))/2.0) * dpt1_real(ilev);
+    }, KEner);
 
-      // Compute KEner
-      KEner = 0.0;
-      Dispatch<>::parallel_reduce(kv.team, Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+    if (!m_theta_hydrostatic_mode) {
+      Real sum = 0.0;
+      auto w_i = viewAsReal(Homme::subview(m_state.m_w_i,kv.ie,t1,igp,jgp));
+      Dispatch<>::parallel_reduce(kv.team,Kokkos::ThreadVectorRange(kv.team,NUM_PHYSICAL_LEV),
                                   [&](const int ilev, Real& accumulator){
-        accumulator += ((u(ilev)*u(ilev) + v(ilev)*v(ilev))/2.0) * dpt1_real(ilev);
-      }, KEner);
-
-      if (!m_theta_hydrostatic_mode) {
-        Real sum = 0.0;
-        auto w_i = viewAsReal(Homme::subview(m_state.m_w_i,kv.ie,t1,igp,jgp));
-        Dispatch<>::parallel_reduce(kv.team,Kokkos::ThreadVectorRange(kv.team,NUM_PHYSICAL_LEV),
-                                    [&](const int ilev, Real& accumulator){
-          accumulator += (w_i(ilev)*w_i(ilev) + w_i(ilev+1)*w_i(ilev+1))/4.0 *dpt1_real(ilev);
-        },sum);
-
-        // Only one thread can update KEner
-        Kokkos::single(Kokkos::PerThread(kv.team),[&](){
-          KEner += sum;
-        });
-      }
-
-      // Compute PEner
-      PEner = 0.0;
-      Dispatch<>::parallel_reduce(kv.team,Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
-                                [&](const int ilev, Real& accumulator){
-        accumulator += phi_real(ilev)*dpt1_real(ilev);
-      },PEner);
-
-      // Compute IEner
-      IEner = 0.0;
-      Kokkos::Real2 sum;
-      Dispatch<>::parallel_reduce(kv.team,Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
-                                  [&](const int ilev, Kokkos::Real2& accumulator){
-        accumulator.v[0] += PhysicalConstants::cp*vtheta_dp_real(ilev)*exner_real(ilev);
-        accumulator.v[1] += (phi_i_real(ilev+1)-phi_i_real(ilev))*pnh_real(ilev);
+        accumulator += (w_i(ilev)*w_i(ilev) + w_i(ilev+1)*w_i(ilev+1))/4.0 *dpt1_real(ilev);
       },sum);
 
-      IEner = sum.v[0] + sum.v[1] + pnh_real(0)*pnh_real(0);
-    });
+      // Only one thread can update KEner
+      Kokkos::single(Kokkos::PerThread(kv.team),[&](){
+        KEner += sum;
+      });
+    }
+
+    // Compute PEner
+    PEner = 0.0;
+    Dispatch<>::parallel_reduce(kv.team,Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                              [&](const int ilev, Real& accumulator){
+      accumulator += phi_real(ilev)*dpt1_real(ilev);
+    },PEner);
+
+    // Compute IEner
+    IEner = 0.0;
+    Kokkos::Real2 sum;
+    Dispatch<>::parallel_reduce(kv.team,Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                                [&](const int ilev, Kokkos::Real2& accumulator){
+      accumulator.v[0] += PhysicalConstants::cp*vtheta_dp_real(ilev)*exner_real(ilev);
+      accumulator.v[1] += (phi_i_real(ilev+1)-phi_i_real(ilev))*pnh_real(ilev);
+    },sum);
+
+    IEner = sum.v[0] + sum.v[1] + pnh_real(0)*pnh_real(0);
   }
 
-private:
+  void set_time_levels (const bool before_advance);
 
   static constexpr int NUM_DIAG_TIMES = 6;
 
@@ -267,6 +367,11 @@ private:
   ExecViewManaged<Real*[NUM_DIAG_TIMES][QSIZE_D][NP][NP]> d_Qmass;
   ExecViewManaged<Real*                [QSIZE_D][NP][NP]> d_Q1mass;
 
+  // Area-weighted integrals at each point, and their sum over each element,
+  // for compute_global_integrals. Layout of the latter is (integral,element).
+  ExecViewManaged<Real**[NP][NP]> m_point_integrals;
+  ExecViewManaged<Real**>         m_elem_integrals;
+
   HybridVCoord      m_hvcoord;
   EquationOfState   m_eos;
   ElementOps        m_elem_ops;
@@ -277,6 +382,7 @@ private:
 
   Kokkos::TeamPolicy<ExecSpace, DiagScalarsTag>     m_policy_diag_scalars;
   Kokkos::TeamPolicy<ExecSpace, EnergyHalfTimesTag> m_policy_energy_halftimes;
+  Kokkos::TeamPolicy<ExecSpace, GlobalIntegralsTag> m_policy_global_integrals;
   TeamUtils<ExecSpace> m_tu;
 
   int t1,t1_qdp,t2_qdp;
@@ -20,6 +20,7 @@
 #include "utilities/scream_tridiag.hpp"
 
 #include <cassert>
+#include <cstdio>
 
 namespace Homme {
 
@@ -31,6 +32,7 @@ struct DirkFunctorImpl {
   enum : int { num_lev_aligned = max_num_lev_pack*packn };
   enum : int { num_phys_lev = NUM_PHYSICAL_LEV };
   enum : int { num_work = 12 };
+  enum : int { max_newton_iter = 20 };
   enum : bool { calc_initial_guess_in_newton_kernel = false };
 
   enum : int {
@@ -41,6 +43,14 @@ struct DirkFunctorImpl {
 #endif
   };
 
+  enum : int {
+#ifdef HOMMEXX_DIRK_COMPACT_NEWTON
+    default_compact_newton = true
+#else
+    default_compact_newton = false
+#endif
+  };
+
   static_assert(num_lev_aligned >= 3,
                 "We use wrk(0:2,:) and so need num_lev_aligned >= 3");
 
@@ -88,9 +98,16 @@ struct DirkFunctorImpl {
   TeamPolicy m_policy, m_ig_policy;
   TeamUtils<ExecSpace> m_tu, m_tu_ig;
   int nslot;
+  int m_team_size, m_vector_size;
+
+  // Compact Newton mode (see run_newton_compact) and its per-element data.
+  bool m_compact;
+  ExecViewManaged<Real*> m_wmax, m_deltaerr;
+  ExecViewManaged<int*> m_converged, m_active[2];
 
-  DirkFunctorImpl (const int nelem)
-    : m_policy(1,1,1), m_ig_policy(1,1,1), m_tu(m_policy), m_tu_ig(m_ig_policy) // throwaway settings
+  DirkFunctorImpl (const int nelem, const bool compact_newton = default_compact_newton)
+    : m_policy(1,1,1), m_ig_policy(1,1,1), m_tu(m_policy), m_tu_ig(m_ig_policy), // throwaway settings
+      m_compact(compact_newton)
   {
     init(nelem);
   }
@@ -109,6 +126,8 @@ struct DirkFunctorImpl {
         nvec = std::min(NP*NP, nhwthr),
         nthr = nhwthr/nvec;
       m_policy = TeamPolicy(nelem, nthr, nvec);
+      m_team_size = nthr;
+      m_vector_size = nvec;
     } else {
       ThreadPreferences tp;
       tp.max_threads_usable = NUM_PHYSICAL_LEV;
@@ -117,9 +136,20 @@ struct DirkFunctorImpl {
       const auto p = DefaultThreadsDistribution<ExecSpace>
         ::team_num_threads_vectors(nelem, tp);
       m_policy = TeamPolicy(nelem, p.first, 1);
+      m_team_size = p.first;
+      m_vector_size = 1;
     }
     m_tu = TeamUtils<ExecSpace>(m_policy);
     nslot = std::min(nelem, m_tu.get_num_ws_slots());
+    if (m_compact) {
+      // Each element keeps its work slot across the Newton kernels.
+      nslot = nelem;
+      m_wmax = ExecViewManaged<Real*>("DIRK wmax", nelem);
+      m_deltaerr = ExecViewManaged<Real*>("DIRK deltaerr", nelem);
+      m_converged = ExecViewManaged<int*>("DIRK converged", nelem);
+      for (int i = 0; i < 2; ++i)
+        m_active[i] = ExecViewManaged<int*>("DIRK active elements", nelem);
+    }
     m_ig_policy = Homme::get_default_team_policy<ExecSpace>(nelem);
     m_tu_ig = TeamUtils<ExecSpace>(m_ig_policy);
   }
@@ -199,61 +229,53 @@ struct DirkFunctorImpl {
     Kokkos::parallel_for(m_ig_policy, toplevel);
   }
 
-  void run_newton (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
-                   const Elements& e, const HybridVCoord& hvcoord, const bool bfb_solver) {
-    using Kokkos::subview;
-    using Kokkos::parallel_for;
-    const auto a = Kokkos::ALL();
-
-    const auto grav = PhysicalConstants::g;
-    const int nvec = npack;
-    const int maxiter = 20;
-#ifdef HOMMEXX_BFB_TESTING
-    const Real deltatol = 1e-6; // In bfb testing, use coarse tolerance, due to zeroulp calls
-#else
-    const Real deltatol = 1e-11; // exit if newton increment < deltatol
-#endif
-
-    const auto work = m_work;
-    const auto ls = m_ls;
-    const auto e_w_i = e.m_state.m_w_i;
-    const auto e_vtheta_dp = e.m_state.m_vtheta_dp;
-    const auto e_phinh_i = e.m_state.m_phinh_i;
-    const auto e_dp3d = e.m_state.m_dp3d;
-    const auto e_v = e.m_state.m_v;
-    const auto e_phis = e.m_geometry.m_phis;
-    const auto e_gradphis = e.m_geometry.m_gradphis;
-    const auto e_initial_guess = e.m_derived.m_divdp_proj;
-    const auto hybi = hvcoord.hybrid_bi;
-    const auto tu   = m_tu;
-
-    const auto toplevel = KOKKOS_LAMBDA (const MT& team, int& nerr) {
-      KernelVariables kv(team, tu);
-      const auto ie = kv.ie;
+  // Per-element steps of the Newton iteration. All data live in the element's
+  // work slot, so that the iteration can be stopped after any step and resumed
+  // in a later kernel, as run_newton_compact does.
+  struct Newton {
+    int nm1, n0, np1;
+    Real alphadt_nm1, alphadt_n0, dt2, deltatol;
+    bool bfb_solver;
+    HybridVCoord hvcoord;
+    Work work;
+    LinearSystem ls;
+    decltype(ElementsState::m_w_i) e_w_i;
+    decltype(ElementsState::m_vtheta_dp) e_vtheta_dp;
+    decltype(ElementsState::m_phinh_i) e_phinh_i;
+    decltype(ElementsState::m_dp3d) e_dp3d;
+    decltype(ElementsState::m_v) e_v;
+    decltype(ElementsGeometry::m_phis) e_phis;
+    decltype(ElementsGeometry::m_gradphis) e_gradphis;
+    decltype(ElementsDerivedState::m_divdp_proj) e_initial_guess;
+    decltype(HybridVCoord::hybrid_bi) hybi;
+
+    // Transpose the state in, compute w_n0, phi_n0, and the initial guess.
+    // Return wmax, which exit_on_step needs.
+    KOKKOS_INLINE_FUNCTION
+    Real setup (const KernelVariables& kv, const int ie, const int slot, int& nerr) const {
+      using Kokkos::subview;
+      const auto a = Kokkos::ALL();
+      const auto grav = PhysicalConstants::g;
       const int nlev = num_phys_lev;
+      const int nvec = npack;
 
       const auto
-      phi_n0    = get_work_slot(work, kv.team_idx,  0),
-      phi_np1   = get_work_slot(work, kv.team_idx,  1),
-      dphi      = get_work_slot(work, kv.team_idx,  2),
-      w_n0      = get_work_slot(work, kv.team_idx,  3),
-      w_np1     = get_work_slot(work, kv.team_idx,  4),
-      dpnh_dp_i = get_work_slot(work, kv.team_idx,  5),
-      gwh_i     = get_work_slot(work, kv.team_idx,  6),
-      dphi_n0   = get_work_slot(work, kv.team_idx,  6), // reuse gwh_i
-      vtheta_dp = get_work_slot(work, kv.team_idx,  7),
-      dp3d      = get_work_slot(work, kv.team_idx,  8),
-      pnh       = get_work_slot(work, kv.team_idx,  9),
-      wrk       = get_work_slot(work, kv.team_idx, 10),
-      xfull     = get_work_slot(work, kv.team_idx, 11);
-      const auto
-      dl = get_ls_slot(ls, kv.team_idx, 0),
-      d  = get_ls_slot(ls, kv.team_idx, 1),
-      du = get_ls_slot(ls, kv.team_idx, 2);
-
-      // View of xfull for use in the solver. We want xfull so that we
-      // can use the nlevp-1 entry, which we make sure is 0, when convenient.
-      LinearSystemSlot x = subview(xfull, Kokkos::pair<int,int>(0,nlev), a);
+      phi_n0    = get_work_slot(work, slot,  0),
+      phi_np1   = get_work_slot(work, slot,  1),
+      dphi      = get_work_slot(work, slot,  2),
+      w_n0      = get_work_slot(work, slot,  3),
+      w_np1     = get_work_slot(work, slot,  4),
+      dpnh_dp_i = get_work_slot(work, slot,  5),
+      gwh_i     = get_work_slot(work, slot,  6),
+      dphi_n0   = get_work_slot(work, slot,  6), // reuse gwh_i
+      vtheta_dp = get_work_slot(work, slot,  7),
+      dp3d      = get_work_slot(work, slot,  8),
+      pnh       = get_work_slot(work, slot,  9),
+      wrk       = get_work_slot(work, slot, 10),
+      xfull     = get_work_slot(work, slot, 11);
+
+      // We want xfull so that we can use the nlevp-1 entry of x, which we make
+      // sure is 0, when convenient.
       xfull(nlev,0)[0] = 0.0;
 
       const auto transpose4 = [&] (const int nt, const bool transpose_phi_np1 = true) {
@@ -339,70 +361,245 @@ struct DirkFunctorImpl {
 
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { dphi_n0(k,i) = phi_n0(k+1,i) - phi_n0(k,i); });
 
-      int it = 0;
-      Real deltaerr;
-      for (; it < maxiter; ++it) { // Newton iteration
-        const bool ok = pnh_and_exner_from_eos(kv, hvcoord, vtheta_dp, dp3d,
-                                               dphi, pnh, wrk, dpnh_dp_i);
-        if ( ! ok) nerr = 1;
-        kv.team_barrier();
-        loop_ki(kv, nlev, nvec, [&] (const int k, const int i) {
-          x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
-        });
+      return wmax;
+    }
 
-        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
-        kv.team_barrier();
-        if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
-        kv.team_barrier();
+    // One Newton step. Return whether the element has converged.
+    KOKKOS_INLINE_FUNCTION
+    bool iterate (const KernelVariables& kv, const int slot, const Real wmax,
+                  Real& deltaerr, int& nerr) const {
+      using Kokkos::subview;
+      const auto a = Kokkos::ALL();
+      const auto grav = PhysicalConstants::g;
+      const int nlev = num_phys_lev;
+      const int nvec = npack;
 
-        loop_ki(kv, 1, nvec, [&] (int k, int i) { wrk(2,i) = 1; });
+      const auto
+      dphi      = get_work_slot(work, slot,  2),
+      w_n0      = get_work_slot(work, slot,  3),
+      w_np1     = get_work_slot(work, slot,  4),
+      dpnh_dp_i = get_work_slot(work, slot,  5),
+      dphi_n0   = get_work_slot(work, slot,  6),
+      vtheta_dp = get_work_slot(work, slot,  7),
+      dp3d      = get_work_slot(work, slot,  8),
+      pnh       = get_work_slot(work, slot,  9),
+      wrk       = get_work_slot(work, slot, 10),
+      xfull     = get_work_slot(work, slot, 11);
+      const auto
+      dl = get_ls_slot(ls, slot, 0),
+      d  = get_ls_slot(ls, slot, 1),
+      du = get_ls_slot(ls, slot, 2);
+      // View of xfull for use in the solver.
+      LinearSystemSlot x = subview(xfull, Kokkos::pair<int,int>(0,nlev), a);
+
+      const bool ok = pnh_and_exner_from_eos(kv, hvcoord, vtheta_dp, dp3d,
+                                             dphi, pnh, wrk, dpnh_dp_i);
+      if ( ! ok) nerr = 1;
+      kv.team_barrier();
+      loop_ki(kv, nlev, nvec, [&] (const int k, const int i) {
+        x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
+      });
+
+      calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+      kv.team_barrier();
+      if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+      kv.team_barrier();
+
+      loop_ki(kv, 1, nvec, [&] (int k, int i) { wrk(2,i) = 1; });
+      kv.team_barrier();
+      for (int nsafe = 0; nsafe < 2; ++nsafe) {
+        loop_ki(kv, nlev-1, nvec, [&] (int k, int i) {
+          dphi(k,i) = dphi_n0(k,i) + dt2*grav*(         (w_np1(k+1,i) - w_np1(k,i)) +
+                                               wrk(2,i)*(    x(k+1,i) -     x(k,i)));
+        });
+        loop_ki(kv, 1, nvec, [&] (int, int i) {
+          const auto k = nlev-1;
+          dphi(k,i) = dphi_n0(k,i) - dt2*grav*(w_np1(k,i) + wrk(2,i)*x(k,i));
+        });
         kv.team_barrier();
-        for (int nsafe = 0; nsafe < 2; ++nsafe) {
-          loop_ki(kv, nlev-1, nvec, [&] (int k, int i) {
-            dphi(k,i) = dphi_n0(k,i) + dt2*grav*(         (w_np1(k+1,i) - w_np1(k,i)) +
-                                                 wrk(2,i)*(    x(k+1,i) -     x(k,i)));
-          });
-          loop_ki(kv, 1, nvec, [&] (int, int i) {
-            const auto k = nlev-1;
-            dphi(k,i) = dphi_n0(k,i) - dt2*grav*(w_np1(k,i) + wrk(2,i)*x(k,i));
-          });
-          kv.team_barrier();
-          calc_whether_ge(kv, nlev, nvec, 0, dphi, wrk);
-          kv.team_barrier();
-          if (wrk(1,0)[0] == 0) break;
-          calc_step_size(kv, nlev, nvec, grav, dt2, dphi_n0, w_np1, x, wrk);
-          kv.team_barrier();
-        }
+        calc_whether_ge(kv, nlev, nvec, 0, dphi, wrk);
+        kv.team_barrier();
+        if (wrk(1,0)[0] == 0) break;
+        calc_step_size(kv, nlev, nvec, grav, dt2, dphi_n0, w_np1, x, wrk);
         kv.team_barrier();
+      }
+      kv.team_barrier();
+
+      loop_ki(kv, nlev, nvec, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
+
+      return exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr);
+    }
+
+    // Update phi_np1 and transpose the solution out.
+    KOKKOS_INLINE_FUNCTION
+    void finish (const KernelVariables& kv, const int ie, const int slot) const {
+      using Kokkos::subview;
+      const auto a = Kokkos::ALL();
+      const auto grav = PhysicalConstants::g;
+      const int nlev = num_phys_lev;
+      const int nvec = npack;
+
+      const auto
+      phi_n0  = get_work_slot(work, slot, 0),
+      phi_np1 = get_work_slot(work, slot, 1),
+      w_np1   = get_work_slot(work, slot, 4);
+
+      loop_ki(kv, nlev, nvec, [&] (int k, int i) { phi_np1(k,i) = phi_n0(k,i) + dt2*grav*w_np1(k,i); });
 
-        loop_ki(kv, nlev, nvec, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
+      kv.team_barrier();
+      transpose(kv, nlev+1, phi_np1, subview(e_phinh_i,ie,np1,a,a,a));
+      transpose(kv, nlev+1, w_np1,   subview(e_w_i    ,ie,np1,a,a,a));
+    }
+  };
 
-        if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+  Newton make_newton (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
+                      const Elements& e, const HybridVCoord& hvcoord, const bool bfb_solver) const {
+    Newton n;
+    n.nm1 = nm1; n.n0 = n0; n.np1 = np1;
+    n.alphadt_nm1 = alphadt_nm1; n.alphadt_n0 = alphadt_n0; n.dt2 = dt2;
+#ifdef HOMMEXX_BFB_TESTING
+    n.deltatol = 1e-6; // In bfb testing, use coarse tolerance, due to zeroulp calls
+#else
+    n.deltatol = 1e-11; // exit if newton increment < deltatol
+#endif
+    n.bfb_solver = bfb_solver;
+    n.hvcoord = hvcoord;
+    n.work = m_work;
+    n.ls = m_ls;
+    n.e_w_i = e.m_state.m_w_i;
+    n.e_vtheta_dp = e.m_state.m_vtheta_dp;
+    n.e_phinh_i = e.m_state.m_phinh_i;
+    n.e_dp3d = e.m_state.m_dp3d;
+    n.e_v = e.m_state.m_v;
+    n.e_phis = e.m_geometry.m_phis;
+    n.e_gradphis = e.m_geometry.m_gradphis;
+    n.e_initial_guess = e.m_derived.m_divdp_proj;
+    n.hybi = hvcoord.hybrid_bi;
+    return n;
+  }
+
+  void run_newton (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
+                   const Elements& e, const HybridVCoord& hvcoord, const bool bfb_solver) {
+    if (m_compact) {
+      run_newton_compact(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, e, hvcoord, bfb_solver);
+      return;
+    }
+
+    const auto newton = make_newton(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, e, hvcoord, bfb_solver);
+    const auto tu = m_tu;
+
+    const auto toplevel = KOKKOS_LAMBDA (const MT& team, int& nerr) {
+      KernelVariables kv(team, tu);
+      const auto wmax = newton.setup(kv, kv.ie, kv.team_idx, nerr);
+
+      int it = 0;
+      Real deltaerr;
+      for (; it < max_newton_iter; ++it) { // Newton iteration
+        if (newton.iterate(kv, kv.team_idx, wmax, deltaerr, nerr)) break;
       } // Newton iteration
       kv.team_barrier();
 
-      if (it >= maxiter) {
+      if (it >= max_newton_iter) {
         Kokkos::printf("[DIRK] WARNING! Newton reached max iteration count,"
                        " with deltaerr = %3.17f\n", deltaerr);
         nerr = 1;
       }
 
-      // Update phi_np1.
-      loop_ki(kv, nlev, nvec, [&] (int k, int i) { phi_np1(k,i) = phi_n0(k,i) + dt2*grav*w_np1(k,i); });
-
-      kv.team_barrier();
-      transpose(kv, nlev+1, phi_np1, subview(e_phinh_i,ie,np1,a,a,a));
-      transpose(kv, nlev+1, w_np1,   subview(e_w_i    ,ie,np1,a,a,a));
+      newton.finish(kv, kv.ie, kv.team_idx);
     };
 
     int nerr;
     Kokkos::parallel_reduce(m_policy, toplevel, nerr);
-    if (nerr > 0) {
-      const int nt[] = {nm1, n0, np1};
-      const char* ntname[] = {"nm1", "n0", "np1"};
-      for (int i = 0; i < 3; ++i)
-        check_print_abort_on_bad_elems(std::string("DIRK Newton loop ") + ntname[i], nt[i]);
+    if (nerr > 0) check_bad_elems(nm1, n0, np1);
+  }
+
+  // Newton iteration with one kernel per step. After each step, the elements
+  // that have converged are removed from the list of active elements, so that
+  // later steps launch teams only for the elements that still iterate. Each
+  // element keeps its own work slot for the whole iteration.
+  void run_newton_compact (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
+                           const Elements& e, const HybridVCoord& hvcoord, const bool bfb_solver) {
+    const auto newton = make_newton(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, e, hvcoord, bfb_solver);
+    const auto wmax = m_wmax;
+    const auto deltaerr = m_deltaerr;
+    const auto converged = m_converged;
+    const int nelem = m_policy.league_size();
+
+    int nbad = 0, nerr_k;
+    Kokkos::parallel_reduce(m_policy, KOKKOS_LAMBDA (const MT& team, int& nerr) {
+      KernelVariables kv(team);
+      const auto w = newton.setup(kv, kv.ie, kv.ie, nerr);
+      Kokkos::single(Kokkos::PerTeam(team), [&] () { wmax(kv.ie) = w; });
+    }, nerr_k);
+    nbad += nerr_k;
+
+    auto active = m_active[0], next = m_active[1];
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, nelem),
+                         KOKKOS_LAMBDA (const int i) { active(i) = i; });
+
+    // nactive[it] is the number of elements that need iteration it.
+    int nactive[max_newton_iter+1];
+    nactive[0] = nelem;
+    int it = 0;
+    for (; it < max_newton_iter && nactive[it] > 0; ++it) {
+      const TeamPolicy policy(nactive[it], m_team_size, m_vector_size);
+      Kokkos::parallel_reduce(policy, KOKKOS_LAMBDA (const MT& team, int& nerr) {
+        KernelVariables kv(team);
+        kv.ie = active(team.league_rank());
+        Real de;
+        const bool done = newton.iterate(kv, kv.ie, wmax(kv.ie), de, nerr);
+        Kokkos::single(Kokkos::PerTeam(team), [&] () {
+          converged(kv.ie) = done;
+          deltaerr(kv.ie) = de;
+        });
+      }, nerr_k);
+      nbad += nerr_k;
+
+      // Gather the elements that have not converged into the next list.
+      Kokkos::parallel_scan(Kokkos::RangePolicy<ExecSpace>(0, nactive[it]),
+                            KOKKOS_LAMBDA (const int i, int& k, const bool final) {
+        const int ie = active(i);
+        if (converged(ie)) return;
+        if (final) next(k) = ie;
+        ++k;
+      }, nactive[it+1]);
+      std::swap(active, next);
+    }
+
+    if (nactive[it] > 0) {
+      Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, nactive[it]),
+                           KOKKOS_LAMBDA (const int i) {
+        Kokkos::printf("[DIRK] WARNING! Newton reached max iteration count,"
+                       " with deltaerr = %3.17f\n", deltaerr(active(i)));
+      });
+      nbad += 1;
+    }
+
+    Kokkos::parallel_for(m_policy, KOKKOS_LAMBDA (const MT& team) {
+      KernelVariables kv(team);
+      newton.finish(kv, kv.ie, kv.ie);
+    });
+
+    // Report the histogram of iteration counts as call counts of event
+    // timers, one per iteration count.
+    for (int i = 1; i <= it; ++i) {
+      const int ncnv = nactive[i-1] - nactive[i];
+      if (ncnv == 0) continue;
+      char name[64];
+      std::snprintf(name, sizeof(name), "compute_stage_value_dirk_newton_its_%02d", i);
+      GPTLstartstop_vals(name, 0, ncnv);
     }
+    if (nactive[it] > 0)
+      GPTLstartstop_vals("compute_stage_value_dirk_newton_not_converged", 0, nactive[it]);
+
+    if (nbad > 0) check_bad_elems(nm1, n0, np1);
+  }
+
+  static void check_bad_elems (const int nm1, const int n0, const int np1) {
+    const int nt[] = {nm1, n0, np1};
+    const char* ntname[] = {"nm1", "n0", "np1"};
+    for (int i = 0; i < 3; ++i)
+      check_print_abort_on_bad_elems(std::string("DIRK Newton loop ") + ntname[i], nt[i]);
   }
 
   template <typename Fn>
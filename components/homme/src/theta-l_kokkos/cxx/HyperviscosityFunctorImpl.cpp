@@ -40,6 +40,12 @@ HyperviscosityFunctorImpl (const SimulationParams&     params,
  , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
  , m_policy_sgsturb_laplace (Homme::get_default_team_policy<ExecSpace, TagSGSTurbLaplace>(m_num_elems))
  , m_policy_sgsturb_update_states (Homme::get_default_team_policy<ExecSpace,TagSGSTurbUpdateStates>(m_num_elems))
+ , m_policy_update_states_first_laplace (Homme::get_default_team_policy<ExecSpace,TagUpdateStatesFirstLaplaceHV>(m_num_elems))
+ , m_policy_second_laplace_const_pre_exchange (Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHVPreExchange>(m_num_elems))
+ , m_policy_second_laplace_tensor_pre_exchange (Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHVPreExchange>(m_num_elems))
+ , m_policy_nutop_update_states_laplace (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStatesLaplace>(m_num_elems))
+ , m_policy_sgsturb_update_states_laplace (Homme::get_default_team_policy<ExecSpace,TagSGSTurbUpdateStatesLaplace>(m_num_elems))
+ , m_fuse_subcycles(false)
  , m_tu(m_policy_update_states)
 {
   init_params(params);
@@ -63,6 +69,12 @@ HyperviscosityFunctorImpl (const int num_elems, const SimulationParams &params)
   , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
   , m_policy_sgsturb_laplace (Homme::get_default_team_policy<ExecSpace, TagSGSTurbLaplace>(m_num_elems))
   , m_policy_sgsturb_update_states (Homme::get_default_team_policy<ExecSpace,TagSGSTurbUpdateStates>(m_num_elems))
+  , m_policy_update_states_first_laplace (Homme::get_default_team_policy<ExecSpace,TagUpdateStatesFirstLaplaceHV>(m_num_elems))
+  , m_policy_second_laplace_const_pre_exchange (Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHVPreExchange>(m_num_elems))
+  , m_policy_second_laplace_tensor_pre_exchange (Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHVPreExchange>(m_num_elems))
+  , m_policy_nutop_update_states_laplace (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStatesLaplace>(m_num_elems))
+  , m_policy_sgsturb_update_states_laplace (Homme::get_default_team_policy<ExecSpace,TagSGSTurbUpdateStatesLaplace>(m_num_elems))
+  , m_fuse_subcycles(false)
   , m_tu(m_policy_update_states)
 {
   init_params(params);
@@ -282,31 +294,75 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   });
   Kokkos::fence();
 
-  for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
-    GPTLstart("hvf-bhwk");
-    biharmonic_wk_theta ();
-    GPTLstop("hvf-bhwk");
+  if (m_fuse_subcycles) {
+    // Same as below, except that the states update of each subcycle is done
+    // in the same kernel as the first laplacian of the next subcycle, and the
+    // second laplacian in the same kernel as the pre-exchange scaling. Both
+    // pairs of kernels only touch data of the element they work on.
+    for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
+      GPTLstart("hvf-bhwk");
+      if (icycle==0) {
+        Kokkos::parallel_for(m_policy_first_laplace, *this);
+      } else {
+        Kokkos::parallel_for(m_policy_update_states_first_laplace, *this);
+      }
+      Kokkos::fence();
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
-    Kokkos::fence();
+      assert (m_be->is_registration_completed());
+      GPTLstart("hvf-bexch");
+      m_be->exchange(m_geometry.m_rspheremp);
+      GPTLstop("hvf-bexch");
+
+      if ( m_data.consthv ) {
+        Kokkos::parallel_for(m_policy_second_laplace_const_pre_exchange, *this);
+      } else {
+        Kokkos::parallel_for(m_policy_second_laplace_tensor_pre_exchange, *this);
+      }
+      Kokkos::fence();
+      GPTLstop("hvf-bhwk");
 
-    // Exchange
-    assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+      GPTLstart("hvf-bexch");
+      m_be->exchange();
+      GPTLstop("hvf-bexch");
+    } //subcycle
 
-    // Update states
-    Kokkos::parallel_for(m_policy_update_states, *this);
-    Kokkos::fence();
+    // Update states of the last subcycle
+    if (m_data.hypervis_subcycle > 0) {
+      Kokkos::parallel_for(m_policy_update_states, *this);
+      Kokkos::fence();
+    }
+  } else {
+    for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
+      GPTLstart("hvf-bhwk");
+      biharmonic_wk_theta ();
+      GPTLstop("hvf-bhwk");
 
-  } //subcycle
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+      Kokkos::fence();
+
+      // Exchange
+      assert (m_be->is_registration_completed());
+      GPTLstart("hvf-bexch");
+      m_be->exchange();
+      GPTLstop("hvf-bexch");
+
+      // Update states
+      Kokkos::parallel_for(m_policy_update_states, *this);
+      Kokkos::fence();
+
+    } //subcycle
+  }
 
   // SGS Horizontal turbulent diffusion
   if (m_data.do_3d_turbulence > 0) {
     for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
-      // laplace(fields) --> ttens, etc.
-      Kokkos::parallel_for(m_policy_sgsturb_laplace, *this);
+      // laplace(fields) --> ttens, etc. If fusing subcycles, the previous
+      // subcycle update is done in the same kernel.
+      if (m_fuse_subcycles && icycle>0) {
+        Kokkos::parallel_for(m_policy_sgsturb_update_states_laplace, *this);
+      } else {
+        Kokkos::parallel_for(m_policy_sgsturb_laplace, *this);
+      }
       Kokkos::fence();
 
       // exchange is done on ttens, dptens, vtens, etc.
@@ -316,8 +372,10 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
       GPTLstop("sgsturb-bexch");
 
       // update states
-      Kokkos::parallel_for(m_policy_sgsturb_update_states, *this);
-      Kokkos::fence();
+      if (!m_fuse_subcycles || icycle==m_data.hypervis_subcycle-1) {
+        Kokkos::parallel_for(m_policy_sgsturb_update_states, *this);
+        Kokkos::fence();
+      }
     }
   } // SGS horizontal turbulent diffusion
 
@@ -370,8 +428,13 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   // sponge layer 
   if (m_data.nu_top > 0) {
     for (int icycle = 0; icycle < m_data.hypervis_subcycle_tom; ++icycle) {
-      // laplace(fields) --> ttens, etc.
-      Kokkos::parallel_for(m_policy_nutop_laplace, *this);
+      // laplace(fields) --> ttens, etc. If fusing subcycles, the previous
+      // subcycle update is done in the same kernel.
+      if (m_fuse_subcycles && icycle>0) {
+        Kokkos::parallel_for(m_policy_nutop_update_states_laplace, *this);
+      } else {
+        Kokkos::parallel_for(m_policy_nutop_laplace, *this);
+      }
       Kokkos::fence();
 
       // exchange is done on ttens, dptens, vtens, etc.
@@ -380,8 +443,10 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
       m_be_tom->exchange();
       GPTLstop("hvf-bexch");
 
-      Kokkos::parallel_for(m_policy_nutop_update_states, *this);
-      Kokkos::fence();
+      if (!m_fuse_subcycles || icycle==m_data.hypervis_subcycle_tom-1) {
+        Kokkos::parallel_for(m_policy_nutop_update_states, *this);
+        Kokkos::fence();
+      }
     }
   } // for sponge layer
 } // run()
@@ -542,6 +607,13 @@ void HyperviscosityFunctorImpl::operator() (const TagNutopUpdateStates&, const T
   }); // threadteamrange
 } // tagUpdateStates2
 
+KOKKOS_INLINE_FUNCTION
+void HyperviscosityFunctorImpl::operator() (const TagNutopUpdateStatesLaplace&, const TeamMember& team) const {
+  operator()(TagNutopUpdateStates(), team);
+  team.team_barrier();
+  operator()(TagNutopLaplace(), team);
+}
+
 // Laplace for horizontal SGS turbulent diffusion
 KOKKOS_INLINE_FUNCTION
 void HyperviscosityFunctorImpl::operator() (const TagSGSTurbLaplace&, const TeamMember& team) const {
@@ -685,4 +757,11 @@ void HyperviscosityFunctorImpl::operator() (const TagSGSTurbUpdateStates&, const
   }); // threadteamrange
 } // tagSGSTurbUpdateStates
 
+KOKKOS_INLINE_FUNCTION
+void HyperviscosityFunctorImpl::operator() (const TagSGSTurbUpdateStatesLaplace&, const TeamMember& team) const {
+  operator()(TagSGSTurbUpdateStates(), team);
+  team.team_barrier();
+  operator()(TagSGSTurbLaplace(), team);
+}
+
 } // namespace Homme
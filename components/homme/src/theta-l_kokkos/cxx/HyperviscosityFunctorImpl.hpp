@@ -94,6 +94,14 @@ public:
   struct TagSGSTurbUpdateStates {};
   struct TagSGSTurbLaplace {};
 
+  // Fused kernels, used when subcycles are fused: each one runs, for an element,
+  // the two kernels in its name back to back.
+  struct TagUpdateStatesFirstLaplaceHV {};
+  struct TagSecondLaplaceConstHVPreExchange {};
+  struct TagSecondLaplaceTensorHVPreExchange {};
+  struct TagNutopUpdateStatesLaplace {};
+  struct TagSGSTurbUpdateStatesLaplace {};
+
   HyperviscosityFunctorImpl (const SimulationParams&     params,
                              const ElementsGeometry&     geometry,
                              const ElementsState&        state,
@@ -113,6 +121,13 @@ public:
 
   void run (const int np1, const Real dt, const Real eta_ave_w);
 
+  // If on, the state update of each subcycle runs in the same kernel as the
+  // first Laplacian of the next one, and the second Laplacian in the same kernel
+  // as the scaling by the viscosity coefficients. This halves the kernel launches
+  // per subcycle, and is expected to be BFB with the unfused path (see hv_ut).
+  // Off by default.
+  void set_fuse_subcycles (const bool fuse) { m_fuse_subcycles = fuse; }
+
   void biharmonic_wk_theta () const;
 
   // first iter of laplace, const hv
@@ -205,6 +220,12 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagSGSTurbUpdateStates&, const TeamMember& team) const;
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagNutopUpdateStatesLaplace&, const TeamMember& team) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagSGSTurbUpdateStatesLaplace&, const TeamMember& team) const;
+
   //second iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagSecondLaplaceConstHV&, const TeamMember& team) const {
@@ -399,6 +420,27 @@ public:
     });//parallel 4
   } //taghyperpreexchange
 
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagUpdateStatesFirstLaplaceHV&, const TeamMember& team) const {
+    operator()(TagUpdateStates(), team);
+    team.team_barrier();
+    operator()(TagFirstLaplaceHV(), team);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagSecondLaplaceConstHVPreExchange&, const TeamMember& team) const {
+    operator()(TagSecondLaplaceConstHV(), team);
+    team.team_barrier();
+    operator()(TagHyperPreExchange(), team);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagSecondLaplaceTensorHVPreExchange&, const TeamMember& team) const {
+    operator()(TagSecondLaplaceTensorHV(), team);
+    team.team_barrier();
+    operator()(TagHyperPreExchange(), team);
+  }
+
 protected:
 
   const int             m_num_elems;
@@ -425,6 +467,14 @@ protected:
   Kokkos::TeamPolicy<ExecSpace,TagSGSTurbLaplace>      m_policy_sgsturb_laplace;
   Kokkos::TeamPolicy<ExecSpace,TagSGSTurbUpdateStates> m_policy_sgsturb_update_states;
 
+  Kokkos::TeamPolicy<ExecSpace,TagUpdateStatesFirstLaplaceHV>       m_policy_update_states_first_laplace;
+  Kokkos::TeamPolicy<ExecSpace,TagSecondLaplaceConstHVPreExchange>  m_policy_second_laplace_const_pre_exchange;
+  Kokkos::TeamPolicy<ExecSpace,TagSecondLaplaceTensorHVPreExchange> m_policy_second_laplace_tensor_pre_exchange;
+  Kokkos::TeamPolicy<ExecSpace,TagNutopUpdateStatesLaplace>         m_policy_nutop_update_states_laplace;
+  Kokkos::TeamPolicy<ExecSpace,TagSGSTurbUpdateStatesLaplace>       m_policy_sgsturb_update_states_laplace;
+
+  bool m_fuse_subcycles;
+
   TeamUtils<ExecSpace> m_tu; // If the policies only differ by tag, just need one tu
 
   std::shared_ptr<BoundaryExchange> m_be, m_be_tom, m_be_sgs;
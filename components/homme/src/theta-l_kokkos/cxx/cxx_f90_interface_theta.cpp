@@ -635,6 +635,12 @@ void sync_diagnostics_to_host_c ()
   Context::singleton().get<Diagnostics>().sync_diagnostics_to_host();
 }
 
+void compute_global_integrals_c (const int& before_advance, const int& reproducible, F90Ptr& integrals_ptr)
+{
+  Context::singleton().get<Diagnostics>().compute_global_integrals(before_advance!=0, integrals_ptr,
+                                                                   reproducible!=0);
+}
+
 } // extern "C"
 
 } // namespace Homme
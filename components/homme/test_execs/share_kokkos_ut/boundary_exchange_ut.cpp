@@ -4,6 +4,7 @@
 #include "mpi/MpiBuffersManager.hpp"
 #include "mpi/BoundaryExchange.hpp"
 #include "mpi/Connectivity.hpp"
+#include "mpi/Repartitioner.hpp"
 #include "utilities/SubviewUtils.hpp"
 #include "utilities/SyncUtils.hpp"
 #include "utilities/TestUtils.hpp"
@@ -302,6 +303,87 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+  // Repartition with a non uniform cost, and check that the migrated data and
+  // the new connectivity agree on the element ids, and that exchanging a field
+  // on the new partition gives the same result as on the original one
+  {
+    const auto h_ucon = connectivity->get_h_ucon();
+    const auto h_ucon_ptr = connectivity->get_h_ucon_ptr();
+    std::vector<Real> cost(num_elements);
+    ExecViewManaged<int*[2]> gids("gids", num_elements);
+    auto gids_h = Kokkos::create_mirror_view(gids);
+    for (int ie=0; ie<num_elements; ++ie) {
+      const int gid = h_ucon(h_ucon_ptr(ie)).local.gid;
+      cost[ie] = 1 + gid%3;
+      gids_h(ie,0) = gid;
+      gids_h(ie,1) = rank;
+    }
+    Kokkos::deep_copy(gids, gids_h);
+
+    ExecViewManaged<Real*[NP][NP]> field("field", num_elements);
+    ExecViewManaged<Real*[NP][NP]> field_exch("field_exch", num_elements);
+    genRandArray(field,engine,dreal);
+    Kokkos::deep_copy(field_exch, field);
+    {
+      auto be = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+      be->set_num_fields(0,1,0);
+      be->register_field(field_exch);
+      be->registration_completed();
+      be->exchange();
+    }
+
+    for (auto method : {Repartitioner::Method::SFC, Repartitioner::Method::Graph}) {
+      Repartitioner rp(connectivity);
+      rp.compute(cost, method);
+      REQUIRE(rp.imbalance_after() >= 1);
+      REQUIRE(rp.imbalance_after() <= rp.imbalance_before());
+
+      auto new_gids = gids;
+      rp.migrate(new_gids);
+      auto new_connectivity = std::make_shared<Connectivity>();
+      rp.build_connectivity(*new_connectivity);
+      REQUIRE(new_connectivity->get_num_local_elements() == rp.num_new_local_elements());
+
+      int num_new_global, num_global;
+      int num_new_local = rp.num_new_local_elements();
+      MPI_Allreduce(&num_new_local, &num_new_global, 1, MPI_INT, MPI_SUM, connectivity->get_comm().mpi_comm());
+      MPI_Allreduce(&num_elements, &num_global, 1, MPI_INT, MPI_SUM, connectivity->get_comm().mpi_comm());
+      REQUIRE(num_new_global == num_global);
+
+      const auto new_gids_h = Kokkos::create_mirror_view(new_gids);
+      Kokkos::deep_copy(new_gids_h, new_gids);
+      const auto new_ucon = new_connectivity->get_h_ucon();
+      const auto new_ucon_ptr = new_connectivity->get_h_ucon_ptr();
+      for (int ie=0; ie<num_new_local; ++ie) {
+        REQUIRE(new_ucon(new_ucon_ptr(ie)).local.gid == new_gids_h(ie,0));
+      }
+
+      // Exchange the migrated field on the new partition, and compare with the
+      // migrated result of the exchange on the original partition.
+      auto new_field = field;
+      auto new_field_exch = field_exch;
+      rp.migrate(new_field);
+      rp.migrate(new_field_exch);
+      {
+        auto new_buffers_manager = std::make_shared<MpiBuffersManager>(new_connectivity);
+        auto be = std::make_shared<BoundaryExchange>(new_connectivity,new_buffers_manager);
+        be->set_num_fields(0,1,0);
+        be->register_field(new_field);
+        be->registration_completed();
+        be->exchange();
+      }
+      const auto new_field_h = Kokkos::create_mirror_view(new_field);
+      const auto new_field_exch_h = Kokkos::create_mirror_view(new_field_exch);
+      Kokkos::deep_copy(new_field_h, new_field);
+      Kokkos::deep_copy(new_field_exch_h, new_field_exch);
+      for (int ie=0; ie<num_new_local; ++ie) {
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            REQUIRE(compare_answers(new_field_exch_h(ie,igp,jgp),new_field_h(ie,igp,jgp)) < test_tolerance);
+      }}}
+    }
+  }
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
@@ -338,6 +338,11 @@ class compute_sphere_operator_test_ml {
   struct TagVLaplaceContraML {};
   // tag for vorticity_sphere
   struct TagVorticityVectorML {};
+  // tags for the small-GEMM variants
+  struct TagGradientSphereGemmML {};
+  struct TagDivergenceSphereGemmML {};
+  struct TagSimpleLaplaceGemmML {};
+  struct TagVorticityVectorGemmML {};
   // tag for default, a dummy
   struct TagDefault {};
 
@@ -464,6 +469,61 @@ class compute_sphere_operator_test_ml {
 
 
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagGradientSphereGemmML &,
+                  const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.gradient_sphere_gemm(kv,
+                    Homme::subview(scalar_input_d, kv.ie),
+                    Homme::subview(vector_output_d,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagDivergenceSphereGemmML &,
+                  const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.divergence_sphere_gemm(kv,
+                         Homme::subview(vector_input_d, kv.ie),
+                         Homme::subview(scalar_output_d,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagSimpleLaplaceGemmML &,
+                  const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.laplace_simple_gemm(kv,
+                   Homme::subview(scalar_input_d, kv.ie),
+                   Homme::subview(scalar_output_d,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagVorticityVectorGemmML &,
+                  const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.vorticity_sphere_gemm (kv,
+                      Homme::subview(vector_input_d, kv.ie),
+                      Homme::subview(scalar_output_d,kv.ie));
+  }
+
+  // Runs the operator nrepeat times, and returns the average time per run.
+  // The output is left in scalar_output_host/vector_output_host.
+  template<typename Tag>
+  double run_functor_timed(const int nrepeat) {
+    auto policy = Homme::get_default_team_policy<ExecSpace, Tag>(_num_elems);
+    sphere_ops.allocate_buffers(policy);
+    Kokkos::parallel_for(policy, *this);
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    for (int r = 0; r < nrepeat; ++r) {
+      Kokkos::parallel_for(policy, *this);
+    }
+    Kokkos::fence();
+    const double elapsed = timer.seconds() / nrepeat;
+    Kokkos::deep_copy(scalar_output_host, scalar_output_d);
+    Kokkos::deep_copy(vector_output_host, vector_output_d);
+    return elapsed;
+  }
+
   void run_functor_gradient_sphere() {
     // league, team, vector_length_request=1
     auto policy = Homme::get_default_team_policy<ExecSpace, TagGradientSphereML>(_num_elems);
@@ -1340,3 +1400,68 @@ TEST_CASE("vorticity_sphere_vector",
   std::cout << "test vorticity_sphere_vector multilevel finished. \n";
 
 }  // end of test div_sphere_wk_ml
+
+// Checks the small-GEMM variants against the current implementation, and
+// compares their run times. All but the laplacian must be BFB, since they only
+// reorganize the loops, not the sums. The weak divergence in the laplacian
+// sums the two directions separately, so it only agrees up to roundoff.
+TEST_CASE("sphere_op_gemm", "sphere_op_gemm") {
+  constexpr const int elements = 600;
+  constexpr const int nrepeat = 20;
+
+  compute_sphere_operator_test_ml t(elements);
+
+  auto compare = [&](const char* name, const double tref, const double tgemm,
+                     const bool vector_out, const decltype(t.scalar_output_host)& sref,
+                     const decltype(t.vector_output_host)& vref, const Real tol) {
+    Real maxval = 0, maxdiff = 0;
+    const int ncomp = vector_out ? 2 : 1;
+    for (int ie = 0; ie < elements; ++ie) {
+      for (int c = 0; c < ncomp; ++c) {
+        for (int igp = 0; igp < NP; ++igp) {
+          for (int jgp = 0; jgp < NP; ++jgp) {
+            for (int level = 0; level < NUM_LEV; ++level) {
+              for (int v = 0; v < VECTOR_SIZE; ++v) {
+                const Real a = vector_out ? vref(ie,c,igp,jgp,level)[v] : sref(ie,igp,jgp,level)[v];
+                const Real b = vector_out ? t.vector_output_host(ie,c,igp,jgp,level)[v]
+                                          : t.scalar_output_host(ie,igp,jgp,level)[v];
+                REQUIRE(!std::isnan(b));
+                maxval = std::max(maxval, std::abs(a));
+                maxdiff = std::max(maxdiff, std::abs(a-b));
+              }
+            }
+          }
+        }
+      }
+    }
+    std::cout << "  " << name << ": current " << tref << " s, gemm " << tgemm
+              << " s, speedup " << tref/tgemm << ", max rel diff " << maxdiff/maxval << "\n";
+    REQUIRE(maxdiff <= tol*maxval);
+  };
+
+  using Test = compute_sphere_operator_test_ml;
+  auto sref = Kokkos::create_mirror(t.scalar_output_d);
+  auto vref = Kokkos::create_mirror(t.vector_output_d);
+  double tref, tgemm;
+
+  tref = t.run_functor_timed<Test::TagGradientSphereML>(nrepeat);
+  Kokkos::deep_copy(vref, t.vector_output_host);
+  tgemm = t.run_functor_timed<Test::TagGradientSphereGemmML>(nrepeat);
+  compare("gradient_sphere", tref, tgemm, true, sref, vref, 0);
+
+  tref = t.run_functor_timed<Test::TagDivergenceSphereML>(nrepeat);
+  Kokkos::deep_copy(sref, t.scalar_output_host);
+  tgemm = t.run_functor_timed<Test::TagDivergenceSphereGemmML>(nrepeat);
+  compare("divergence_sphere", tref, tgemm, false, sref, vref, 0);
+
+  tref = t.run_functor_timed<Test::TagVorticityVectorML>(nrepeat);
+  Kokkos::deep_copy(sref, t.scalar_output_host);
+  tgemm = t.run_functor_timed<Test::TagVorticityVectorGemmML>(nrepeat);
+  compare("vorticity_sphere", tref, tgemm, false, sref, vref, 0);
+
+  tref = t.run_functor_timed<Test::TagSimpleLaplaceML>(nrepeat);
+  Kokkos::deep_copy(sref, t.scalar_output_host);
+  tgemm = t.run_functor_timed<Test::TagSimpleLaplaceGemmML>(nrepeat);
+  compare("laplace_simple", tref, tgemm, false, sref, vref,
+          1000*std::numeric_limits<Real>::epsilon());
+}
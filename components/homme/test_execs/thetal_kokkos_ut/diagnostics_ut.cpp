@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+
+#include "Diagnostics.hpp"
+#include "Context.hpp"
+#include "mpi/Comm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Homme;
+
+namespace {
+
+constexpr int nfld  = 4;
+constexpr int nglob = 391;
+
+// Element integrals of all the elements in the global domain, identical on all
+// ranks. The fields span very different magnitudes, and one is all zero.
+std::vector<Real> make_global_integrals () {
+  std::mt19937_64 engine(29);
+  std::uniform_real_distribution<Real> pdf(-1, 1);
+  std::vector<Real> v(nfld*nglob);
+  for (int ie=0; ie<nglob; ++ie) {
+    v[0*nglob+ie] = 1e10*(1 + pdf(engine));
+    v[1*nglob+ie] = pdf(engine);
+    v[2*nglob+ie] = 1e5 + 1e-8*pdf(engine);
+    v[3*nglob+ie] = 0;
+  }
+  return v;
+}
+
+// Sum the integrals of the elements gids, which this rank owns in mpi_comm.
+std::vector<Real> sum (const std::vector<Real>& glob, const std::vector<int>& gids,
+                       const bool reproducible, const MPI_Comm& mpi_comm) {
+  const int nelem = gids.size();
+  ExecViewManaged<Real**> elem_integrals("elem_integrals", nfld, nelem);
+  const auto h = Kokkos::create_mirror_view(elem_integrals);
+  for (int ifld=0; ifld<nfld; ++ifld) {
+    for (int ie=0; ie<nelem; ++ie) {
+      h(ifld,ie) = glob[ifld*nglob+gids[ie]];
+    }
+  }
+  Kokkos::deep_copy(elem_integrals, h);
+  std::vector<Real> integrals(nfld);
+  Diagnostics::sum_element_integrals(elem_integrals, integrals.data(), reproducible, mpi_comm);
+  return integrals;
+}
+
+} // anonymous namespace
+
+TEST_CASE("global_integrals", "diagnostics") {
+  const auto& comm = Context::singleton().get<Comm>();
+  const int rank = comm.rank();
+  const int size = comm.size();
+
+  const auto glob = make_global_integrals();
+
+  // Reference sums, and the magnitude of the sum that bounds the error.
+  std::vector<Real> exact(nfld), sum_abs(nfld);
+  for (int ifld=0; ifld<nfld; ++ifld) {
+    long double s = 0, a = 0;
+    for (int ie=0; ie<nglob; ++ie) {
+      s += glob[ifld*nglob+ie];
+      a += std::abs(glob[ifld*nglob+ie]);
+    }
+    exact[ifld] = s;
+    sum_abs[ifld] = a;
+  }
+
+  // Contiguous blocks of elements on each rank.
+  std::vector<int> block;
+  for (int ie=rank*nglob/size; ie<(rank+1)*nglob/size; ++ie) {
+    block.push_back(ie);
+  }
+
+  // Round robin distribution, in reverse order.
+  std::vector<int> cyclic;
+  for (int ie=nglob-1; ie>=0; --ie) {
+    if (ie % size == rank) {
+      cyclic.push_back(ie);
+    }
+  }
+
+  // All the elements on each rank, shuffled.
+  std::vector<int> all(nglob);
+  for (int ie=0; ie<nglob; ++ie) {
+    all[ie] = ie;
+  }
+  std::shuffle(all.begin(), all.end(), std::mt19937_64(7));
+
+  const auto plain  = sum(glob, block,  false, comm.mpi_comm());
+  const auto repro  = sum(glob, block,  true,  comm.mpi_comm());
+  const auto repro2 = sum(glob, cyclic, true,  comm.mpi_comm());
+  const auto repro1 = sum(glob, all,    true,  MPI_COMM_SELF);
+
+  for (int ifld=0; ifld<nfld; ++ifld) {
+    const Real tol = std::numeric_limits<Real>::epsilon()*sum_abs[ifld];
+    REQUIRE(std::abs(plain[ifld] - exact[ifld]) <= nglob*tol);
+    REQUIRE(std::abs(repro[ifld] - exact[ifld]) <= tol);
+
+    // Bitwise the same for any distribution and order of the elements,
+    // and for any number of ranks.
+    REQUIRE(repro2[ifld] == repro[ifld]);
+    REQUIRE(repro1[ifld] == repro[ifld]);
+  }
+}
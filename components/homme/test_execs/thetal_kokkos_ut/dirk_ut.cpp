@@ -689,9 +689,12 @@ TEST_CASE ("dirk_toplevel_testing") {
   auto& e = s.e;
   const auto nelemd = s.nelemd;
 
-  DirkFunctorImpl d(nelemd);
+  DirkFunctorImpl d(nelemd, false);
   FunctorsBuffersManager fbm;
   init(d, fbm);
+  DirkFunctorImpl dc(nelemd, true /* compact Newton */);
+  FunctorsBuffersManager fbmc;
+  init(dc, fbmc);
 
   { // Test initial guess function.
     init_elems(ne, nelemd, r, hvcoord, e);
@@ -765,6 +768,8 @@ TEST_CASE ("dirk_toplevel_testing") {
         w_i1("w_i1", nelemd), w_i2("w_i2", nelemd);
       decltype(ElementsState::m_phinh_i) phinh_i("phinh_i", nelemd),
         phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd);
+      decltype(ElementsState::m_w_i) w_i3("w_i3", nelemd);
+      decltype(ElementsState::m_phinh_i) phinh_i3("phinh_i3", nelemd);
 
       bool good = false;
       for (int trial = 0; trial < 100 /* don't enter an inf loop */; ++trial) {
@@ -827,6 +832,16 @@ TEST_CASE ("dirk_toplevel_testing") {
         deep_copy(e.m_state.m_w_i, w_i);
         deep_copy(e.m_state.m_phinh_i, phinh_i);
 
+        // Run C++ with BFB solver and compact Newton iteration.
+        dc.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
+               e, hvcoord, true /* BFB solver */);
+        fence();
+        deep_copy(w_i3, e.m_state.m_w_i);
+        deep_copy(phinh_i3, e.m_state.m_phinh_i);
+        // Restore state.
+        deep_copy(e.m_state.m_w_i, w_i);
+        deep_copy(e.m_state.m_phinh_i, phinh_i);
+
         break;
       }
 
@@ -836,6 +851,8 @@ TEST_CASE ("dirk_toplevel_testing") {
       const auto w2m = cmvdc(w_i2);
       const auto phinh1m = cmvdc(phinh_i1);
       const auto phinh2m = cmvdc(phinh_i2);
+      const auto w3m = cmvdc(w_i3);
+      const auto phinh3m = cmvdc(phinh_i3);
 
       // Test that running with BFB and non-BFB solvers produces similar answers.
       for (int ie = 0; ie < nelemd; ++ie)
@@ -848,6 +865,17 @@ TEST_CASE ("dirk_toplevel_testing") {
                 REQUIRE(almost_equal(p1[k], p2[k], 1e6*eps));
             }
 
+      // Test that the compact Newton iteration does not change the answer.
+      for (int ie = 0; ie < nelemd; ++ie)
+        for (int i = 0; i < np; ++i)
+          for (int j = 0; j < np; ++j)
+            for (int f = 0; f < 2; ++f) {
+              Real* p2 = f == 0 ? &w2m(ie,np1,i,j,0)[0] : &phinh2m(ie,np1,i,j,0)[0];
+              Real* p3 = f == 0 ? &w3m(ie,np1,i,j,0)[0] : &phinh3m(ie,np1,i,j,0)[0];
+              for (int k = 0; k < nlev+1; ++k)
+                REQUIRE(p2[k] == p3[k]);
+            }
+
       // Run F90 with BFB solver.
       c2f(e);
       compute_stage_value_dirk_f90(nm1+1, alphadtwt_nm1*dt2, n0+1, alphadtwt_n0*dt2, np1+1, dt2);
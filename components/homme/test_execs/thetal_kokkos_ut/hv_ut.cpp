@@ -103,6 +103,76 @@ public:
   bool process_nh_vars () const { return m_process_nh_vars; }
 };
 
+// The HV functor as a whole is more delicate than biharmonic_wk.
+// In particular, the EOS is used a couple of times. This means
+// that inputs *must* satisfy some minimum requirements, like
+// dp>0, vtheta>0, and d(phi)>0. This is very unlikely with random
+// inputs coming from state.randomize(seed), so we generate data
+// as "realistic" as possible, and perturb it.
+// This computation mimics that of
+// src/theta-l/share/element_ops.F90:initialize_reference_states().
+template<typename RngEngine>
+void init_realistic_states (RngEngine& engine, const bool hydrostatic, const int np1,
+                            const HybridVCoord& hvcoord, const ElementsGeometry& geo,
+                            const ElementsState& state)
+{
+  const int num_elems = state.num_elems();
+  using PDF = std::uniform_real_distribution<Real>;
+  ExecViewManaged<Scalar*[NP][NP][NUM_LEV_P]> perturb("",num_elems);
+
+  static constexpr Real T1 =
+    PhysicalConstants::Tref_lapse_rate*PhysicalConstants::Tref*PhysicalConstants::cp/PhysicalConstants::g;
+  static constexpr Real T0 = PhysicalConstants::Tref-T1;
+
+  constexpr Real noise_lvl = 0.05;
+  genRandArray(perturb,engine,PDF(-noise_lvl,noise_lvl));
+  EquationOfState eos;
+  eos.init(hydrostatic,hvcoord);
+
+  ElementOps elem_ops;
+  elem_ops.init(hvcoord);
+
+  ExecViewManaged<Scalar[NUM_LEV]> buf_m("");
+  ExecViewManaged<Scalar[NUM_LEV_P]> buf_i("");
+  Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace>(num_elems),
+                       KOKKOS_LAMBDA(const TeamMember& team){
+    KernelVariables kv(team);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
+                         [&](const int idx){
+      const int igp = idx / NP;
+      const int jgp = idx % NP;
+
+      auto noise = Homme::subview(perturb,kv.ie,igp,jgp);
+      auto dp = Homme::subview(state.m_dp3d,kv.ie,np1,igp,jgp);
+      auto theta = Homme::subview(state.m_vtheta_dp,kv.ie,np1,igp,jgp);
+      auto phi = Homme::subview(state.m_phinh_i,kv.ie,np1,igp,jgp);
+
+      // First, compute dp = dp_ref+noise
+      hvcoord.compute_dp_ref(kv,state.m_ps_v(kv.ie,np1,igp,jgp),dp);
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
+                           [&](const int ilev){
+        dp(ilev) *= 1.0 + noise(ilev);
+      });
+      // Compute pressure
+      elem_ops.compute_hydrostatic_p(kv,dp,buf_i,buf_m);
+
+      // Compute vtheta_dp = theta_ref*dp, where
+      // theta_ref = T0/exner + T1, exner = (p/p0)^k
+      // theta_ref mimics computation in src/theta-l/share/element_ops.F90:set_theta_ref()
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
+                           [&](const int ilev){
+        theta(ilev) = pow(buf_m(ilev)/PhysicalConstants::p0,PhysicalConstants::kappa);
+        theta(ilev) = T0/theta(ilev) + T1;
+        theta(ilev) *= dp(ilev);
+      });
+
+      // Compute phi
+      eos.compute_phi_i(kv,geo.m_phis(kv.ie,igp,jgp),
+                        theta,buf_m,phi);
+    });
+  });
+}
+
 TEST_CASE("hvf", "biharmonic") {
 
   // Catch runs these blocks of code multiple times, namely once per each
@@ -151,7 +221,8 @@ TEST_CASE("hvf", "biharmonic") {
   //do not set to 0 in the test, won't work
   params.nu_div            = RPDF(1e-6,1e-3)(engine);
   params.hypervis_scaling  = RPDF(0.1,1.0)(engine);
-  params.hypervis_subcycle = IPDF(1,3)(engine);
+  // At least two subcycles, so that the fused kernels are exercised
+  params.hypervis_subcycle = IPDF(2,3)(engine);
   params.hypervis_subcycle_tom = 0;
   params.params_set = true;
 
@@ -455,15 +526,207 @@ TEST_CASE("hvf", "biharmonic") {
         std::cout << "   -> hypervis scaling = " << hv_scaling << "\n";
         params.theta_hydrostatic_mode = hydrostatic;
 
-        // Generate timestep settings
+        // Run both with and without fused subcycles, so that both modes are
+        // checked against f90, for const and tensor hv alike.
+        for (const bool fuse : {false, true}) {
+          std::cout << "     -> fused subcycles: " << (fuse ? "yes" : "no") << "\n";
+
+          // Generate timestep settings
+          const Real dt = RPDF(1e-5,1e-3)(engine);
+          //randomize it? also, dpdiss is not tested in here
+          const Real eta_ave_w = 1.0;
+          int  np1 = IPDF(0,2)(engine);
+          // Sync np1 across ranks. If they are not synced, we may get stuck in an mpi wait
+          MPI_Bcast(&np1,1,MPI_INT,0,c.get<Comm>().mpi_comm());
+
+          // Create the HVF tester
+          HVFTester hvf(params,geo,state,derived);
+
+          FunctorsBuffersManager fbm;
+          fbm.request_size( hvf.requested_buffer_size() );
+          fbm.allocate();
+          hvf.init_buffers(fbm);
+
+          hvf.set_timestep_data(np1,dt,eta_ave_w);
+
+          // Generate random states
+          state.randomize(seed);
+
+          init_realistic_states(engine,hydrostatic,np1,hvcoord,geo,state);
+
+          // The be needs to be inited after the hydrostatic option has been set
+          hvf.init_boundary_exchanges();
+
+          // Copy states into f90 pointers
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][2][NP][NP]> v_f90("",num_elems);
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   w_f90("",num_elems);
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>    dp_f90("",num_elems);
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>    vtheta_f90("",num_elems);
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   phinh_f90("",num_elems);
+
+          sync_to_host(state.m_v,v_f90);
+          sync_to_host(state.m_w_i,w_f90);
+          sync_to_host(state.m_dp3d,dp_f90);
+          sync_to_host(state.m_vtheta_dp,vtheta_f90);
+          sync_to_host(state.m_phinh_i,phinh_f90);
+
+          Real* v_f90_ptr      = v_f90.data();
+          Real* w_f90_ptr      = w_f90.data();
+          Real* dp_f90_ptr     = dp_f90.data();
+          Real* vtheta_f90_ptr = vtheta_f90.data();
+          Real* phinh_f90_ptr  = phinh_f90.data();
+
+          // Update hv settings
+          params.hypervis_scaling = hv_scaling;
+          if (params.nu != params.nu_div) {
+            Real ratio = params.nu_div / params.nu;
+            if (params.hypervis_scaling != 0.0) {
+              params.nu_ratio1 = ratio;
+              params.nu_ratio2 = 1.0;
+            }else{
+              params.nu_ratio1 = ratio;
+              params.nu_ratio2 = 1.0;
+            }
+          }else{
+            params.nu_ratio1 = 1.0;
+            params.nu_ratio2 = 1.0;
+          }
+
+          // Set the viscosity params
+          hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
+
+          // Run the cxx functor
+          hvf.set_fuse_subcycles(fuse);
+          hvf.run(np1,dt,eta_ave_w);
+
+          // Run the f90 functor
+          advance_hypervis_f90(np1+1,dt,eta_ave_w, hv_scaling, hydrostatic,
+                               dp_ref_ptr, theta_ref_ptr, phi_ref_ptr,
+                               v_f90_ptr, w_f90_ptr, vtheta_f90_ptr, dp_f90_ptr, phinh_f90_ptr);
+
+          // Compare answers
+          auto v_cxx      = Kokkos::create_mirror_view(state.m_v);
+          auto w_cxx      = Kokkos::create_mirror_view(state.m_w_i);
+          auto vtheta_cxx = Kokkos::create_mirror_view(state.m_vtheta_dp);
+          auto dp_cxx     = Kokkos::create_mirror_view(state.m_dp3d);
+          auto phinh_cxx  = Kokkos::create_mirror_view(state.m_phinh_i);
+
+          Kokkos::deep_copy(v_cxx,      state.m_v);
+          Kokkos::deep_copy(w_cxx,      state.m_w_i);
+          Kokkos::deep_copy(vtheta_cxx, state.m_vtheta_dp);
+          Kokkos::deep_copy(dp_cxx,     state.m_dp3d);
+          Kokkos::deep_copy(phinh_cxx,  state.m_phinh_i);
+
+          for (int ie=0; ie<num_elems; ++ie) {
+            for (int igp=0; igp<NP; ++igp) {
+              for (int jgp=0; jgp<NP; ++jgp) {
+                for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+                  const int ilev = k / VECTOR_SIZE;
+                  const int ivec = k % VECTOR_SIZE;
+
+                  if (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,0,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("v_cxx: %3.40f\n",v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]);
+                    printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,0,igp,jgp));
+                  }
+                  REQUIRE (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,0,igp,jgp));
+
+                  if (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,1,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("v_cxx: %3.40f\n",v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]);
+                    printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,1,igp,jgp));
+                  }
+                  REQUIRE (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,1,igp,jgp));
+
+                  if (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]!=dp_f90(ie,np1,k,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("dp_cxx: %3.16f\n",dp_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                    printf ("dp_f90: %3.16f\n",dp_f90(ie,np1,k,igp,jgp));
+                  }
+                  REQUIRE (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]==dp_f90(ie,np1,k,igp,jgp));
+
+                  if (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]!=vtheta_f90(ie,np1,k,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("vtheta_cxx: %3.16f\n",vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                    printf ("vtheta_f90: %3.16f\n",vtheta_f90(ie,np1,k,igp,jgp));
+                  }
+                  REQUIRE (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]==vtheta_f90(ie,np1,k,igp,jgp));
+
+                  if (hvf.process_nh_vars()) {
+                    if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
+                      printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                      printf ("w_cxx: %3.16f\n",w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                      printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
+                    }
+                    REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
+
+                    if (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]!=phinh_f90(ie,np1,k,igp,jgp)) {
+                      printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                      printf ("phinh_cxx: %3.16f\n",phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                      printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
+                    }
+                    REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
+                  }
+                }
+
+                if (hvf.process_nh_vars()) {
+                  // Last interface
+                  const int k = NUM_INTERFACE_LEV-1;
+                  const int ilev = ColInfo<NUM_INTERFACE_LEV>::LastPack;
+                  const int ivec = ColInfo<NUM_INTERFACE_LEV>::LastPackEnd;
+
+                  if (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]!=phinh_f90(ie,np1,k,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("phinh_cxx: %3.16f\n",phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                    printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
+                  }
+                  REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
+
+                  if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("w_cxx: %3.16f\n",w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                    printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
+                  }
+                  REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  SECTION ("hypervis_fused_sponge_sgs") {
+    std::cout << "Fused sponge layer and SGS turbulence test:\n";
+
+    // The f90 interface is inited with nu_top=0, so there is no reference
+    // to compare against for the sponge layer. Instead, check that fusing the
+    // subcycles of the sponge layer and SGS turbulence loops yields the same
+    // answer as running them unfused, for the same inputs.
+    params.nu_top = RPDF(1e-6,1e-3)(engine);
+    params.hypervis_subcycle_tom = IPDF(2,3)(engine);
+    params.do_3d_turbulence = true;
+    MPI_Bcast(&params.nu_top,1,MPI_DOUBLE,0,c.get<Comm>().mpi_comm());
+    MPI_Bcast(&params.hypervis_subcycle_tom,1,MPI_INT,0,c.get<Comm>().mpi_comm());
+
+    using PDF = std::uniform_real_distribution<Real>;
+    genRandArray(derived.m_turb_diff_mom,engine,PDF(1e-6,1e-3));
+    genRandArray(derived.m_turb_diff_heat,engine,PDF(1e-6,1e-3));
+
+    for (const bool hydrostatic : {true, false}) {
+      std::cout << " -> " << (hydrostatic ? "hydrostatic" : "non-hydrostatic") << "\n";
+
+      for (Real hv_scaling : {0.0, 1.2345}) {
+        std::cout << "   -> hypervis scaling = " << hv_scaling << "\n";
+        params.theta_hydrostatic_mode = hydrostatic;
+        params.hypervis_scaling = hv_scaling;
+
         const Real dt = RPDF(1e-5,1e-3)(engine);
-        //randomize it? also, dpdiss is not tested in here
         const Real eta_ave_w = 1.0;
         int  np1 = IPDF(0,2)(engine);
-        // Sync np1 across ranks. If they are not synced, we may get stuck in an mpi wait
         MPI_Bcast(&np1,1,MPI_INT,0,c.get<Comm>().mpi_comm());
 
-        // Create the HVF tester
         HVFTester hvf(params,geo,state,derived);
 
         FunctorsBuffersManager fbm;
@@ -472,135 +735,63 @@ TEST_CASE("hvf", "biharmonic") {
         hvf.init_buffers(fbm);
 
         hvf.set_timestep_data(np1,dt,eta_ave_w);
+        hvf.set_hv_data(hv_scaling,1.0,1.0);
 
-        // Generate random states
         state.randomize(seed);
+        init_realistic_states(engine,hydrostatic,np1,hvcoord,geo,state);
 
-        // The HV functor as a whole is more delicate than biharmonic_wk.
-        // In particular, the EOS is used a couple of times. This means
-        // that inputs *must* satisfy some minimum requirements, like
-        // dp>0, vtheta>0, and d(phi)>0. This is very unlikely with random
-        // inputs coming from state.randomize(seed), so we generate data
-        // as "realistic" as possible, and perturb it.
-        // This computation mimics that of
-        // src/theta-l/share/element_ops.F90:initialize_reference_states().
-        using PDF = std::uniform_real_distribution<Real>;
-        ExecViewManaged<Scalar*[NP][NP][NUM_LEV_P]> perturb("",num_elems);
-
-        static constexpr Real T1 =
-          PhysicalConstants::Tref_lapse_rate*PhysicalConstants::Tref*PhysicalConstants::cp/PhysicalConstants::g;
-        static constexpr Real T0 = PhysicalConstants::Tref-T1;
-
-        constexpr Real noise_lvl = 0.05;
-        genRandArray(perturb,engine,PDF(-noise_lvl,noise_lvl));
-        EquationOfState eos;
-        eos.init(hydrostatic,hvcoord);
-
-        ElementOps elem_ops;
-        elem_ops.init(hvcoord);
-
-        ExecViewManaged<Scalar[NUM_LEV]> buf_m("");
-        ExecViewManaged<Scalar[NUM_LEV_P]> buf_i("");
-        Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace>(num_elems),
-                             KOKKOS_LAMBDA(const TeamMember& team){
-          KernelVariables kv(team);
-          Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
-                               [&](const int idx){
-            const int igp = idx / NP;
-            const int jgp = idx % NP;
-
-            auto noise = Homme::subview(perturb,kv.ie,igp,jgp);
-            auto dp = Homme::subview(state.m_dp3d,kv.ie,np1,igp,jgp);
-            auto theta = Homme::subview(state.m_vtheta_dp,kv.ie,np1,igp,jgp);
-            auto phi = Homme::subview(state.m_phinh_i,kv.ie,np1,igp,jgp);
-
-            // First, compute dp = dp_ref+noise
-            hvcoord.compute_dp_ref(kv,state.m_ps_v(kv.ie,np1,igp,jgp),dp);
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
-                                 [&](const int ilev){
-              dp(ilev) *= 1.0 + noise(ilev);
-            });
-            // Compute pressure
-            elem_ops.compute_hydrostatic_p(kv,dp,buf_i,buf_m);
-
-            // Compute vtheta_dp = theta_ref*dp, where
-            // theta_ref = T0/exner + T1, exner = (p/p0)^k
-            // theta_ref mimics computation in src/theta-l/share/element_ops.F90:set_theta_ref()
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
-                                 [&](const int ilev){
-              theta(ilev) = pow(buf_m(ilev)/PhysicalConstants::p0,PhysicalConstants::kappa);
-              theta(ilev) = T0/theta(ilev) + T1;
-              theta(ilev) *= dp(ilev);
-            });
-
-            // Compute phi
-            eos.compute_phi_i(kv,geo.m_phis(kv.ie,igp,jgp),
-                              theta,buf_m,phi);
-          });
-        });
-
-        // The be needs to be inited after the hydrostatic option has been set
         hvf.init_boundary_exchanges();
 
-        // Copy states into f90 pointers
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][2][NP][NP]> v_f90("",num_elems);
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   w_f90("",num_elems);
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>    dp_f90("",num_elems);
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>    vtheta_f90("",num_elems);
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   phinh_f90("",num_elems);
-
-        sync_to_host(state.m_v,v_f90);
-        sync_to_host(state.m_w_i,w_f90);
-        sync_to_host(state.m_dp3d,dp_f90);
-        sync_to_host(state.m_vtheta_dp,vtheta_f90);
-        sync_to_host(state.m_phinh_i,phinh_f90);
-
-        Real* v_f90_ptr      = v_f90.data();
-        Real* w_f90_ptr      = w_f90.data();
-        Real* dp_f90_ptr     = dp_f90.data();
-        Real* vtheta_f90_ptr = vtheta_f90.data();
-        Real* phinh_f90_ptr  = phinh_f90.data();
-
-        // Update hv settings
-        params.hypervis_scaling = hv_scaling;
-        if (params.nu != params.nu_div) {
-          Real ratio = params.nu_div / params.nu;
-          if (params.hypervis_scaling != 0.0) {
-            params.nu_ratio1 = ratio;
-            params.nu_ratio2 = 1.0;
-          }else{
-            params.nu_ratio1 = ratio;
-            params.nu_ratio2 = 1.0;
-          }
-        }else{
-          params.nu_ratio1 = 1.0;
-          params.nu_ratio2 = 1.0;
-        }
-
-        // Set the viscosity params
-        hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
-
-        // Run the cxx functor
+        // Save the inputs, so that both runs start from the same states.
+        // Use create_mirror (not create_mirror_view), to get a deep copy on host too.
+        auto v_in      = Kokkos::create_mirror(state.m_v);
+        auto w_in      = Kokkos::create_mirror(state.m_w_i);
+        auto vtheta_in = Kokkos::create_mirror(state.m_vtheta_dp);
+        auto dp_in     = Kokkos::create_mirror(state.m_dp3d);
+        auto phinh_in  = Kokkos::create_mirror(state.m_phinh_i);
+        Kokkos::deep_copy(v_in,      state.m_v);
+        Kokkos::deep_copy(w_in,      state.m_w_i);
+        Kokkos::deep_copy(vtheta_in, state.m_vtheta_dp);
+        Kokkos::deep_copy(dp_in,     state.m_dp3d);
+        Kokkos::deep_copy(phinh_in,  state.m_phinh_i);
+
+        // Unfused run: this is the reference
+        hvf.set_fuse_subcycles(false);
         hvf.run(np1,dt,eta_ave_w);
 
-        // Run the f90 functor
-        advance_hypervis_f90(np1+1,dt,eta_ave_w, hv_scaling, hydrostatic,
-                             dp_ref_ptr, theta_ref_ptr, phi_ref_ptr,
-                             v_f90_ptr, w_f90_ptr, vtheta_f90_ptr, dp_f90_ptr, phinh_f90_ptr);
+        auto v_ref      = Kokkos::create_mirror(state.m_v);
+        auto w_ref      = Kokkos::create_mirror(state.m_w_i);
+        auto vtheta_ref = Kokkos::create_mirror(state.m_vtheta_dp);
+        auto dp_ref     = Kokkos::create_mirror(state.m_dp3d);
+        auto phinh_ref  = Kokkos::create_mirror(state.m_phinh_i);
+        Kokkos::deep_copy(v_ref,      state.m_v);
+        Kokkos::deep_copy(w_ref,      state.m_w_i);
+        Kokkos::deep_copy(vtheta_ref, state.m_vtheta_dp);
+        Kokkos::deep_copy(dp_ref,     state.m_dp3d);
+        Kokkos::deep_copy(phinh_ref,  state.m_phinh_i);
+
+        // Fused run, from the same inputs
+        Kokkos::deep_copy(state.m_v,         v_in);
+        Kokkos::deep_copy(state.m_w_i,       w_in);
+        Kokkos::deep_copy(state.m_vtheta_dp, vtheta_in);
+        Kokkos::deep_copy(state.m_dp3d,      dp_in);
+        Kokkos::deep_copy(state.m_phinh_i,   phinh_in);
+
+        hvf.set_fuse_subcycles(true);
+        hvf.run(np1,dt,eta_ave_w);
 
-        // Compare answers
         auto v_cxx      = Kokkos::create_mirror_view(state.m_v);
         auto w_cxx      = Kokkos::create_mirror_view(state.m_w_i);
         auto vtheta_cxx = Kokkos::create_mirror_view(state.m_vtheta_dp);
         auto dp_cxx     = Kokkos::create_mirror_view(state.m_dp3d);
         auto phinh_cxx  = Kokkos::create_mirror_view(state.m_phinh_i);
-
         Kokkos::deep_copy(v_cxx,      state.m_v);
         Kokkos::deep_copy(w_cxx,      state.m_w_i);
         Kokkos::deep_copy(vtheta_cxx, state.m_vtheta_dp);
         Kokkos::deep_copy(dp_cxx,     state.m_dp3d);
         Kokkos::deep_copy(phinh_cxx,  state.m_phinh_i);
 
+        // Compare answers (bitwise)
         for (int ie=0; ie<num_elems; ++ie) {
           for (int igp=0; igp<NP; ++igp) {
             for (int jgp=0; jgp<NP; ++jgp) {
@@ -608,70 +799,20 @@ TEST_CASE("hvf", "biharmonic") {
                 const int ilev = k / VECTOR_SIZE;
                 const int ivec = k % VECTOR_SIZE;
 
-                if (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,0,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("v_cxx: %3.40f\n",v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]);
-                  printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,0,igp,jgp));
-                }
-                REQUIRE (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,0,igp,jgp));
-
-                if (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,1,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("v_cxx: %3.40f\n",v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]);
-                  printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,1,igp,jgp));
-                }
-                REQUIRE (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,1,igp,jgp));
-
-                if (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]!=dp_f90(ie,np1,k,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("dp_cxx: %3.16f\n",dp_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                  printf ("dp_f90: %3.16f\n",dp_f90(ie,np1,k,igp,jgp));
-                }
-                REQUIRE (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]==dp_f90(ie,np1,k,igp,jgp));
-
-                if (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]!=vtheta_f90(ie,np1,k,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("vtheta_cxx: %3.16f\n",vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                  printf ("vtheta_f90: %3.16f\n",vtheta_f90(ie,np1,k,igp,jgp));
-                }
-                REQUIRE (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]==vtheta_f90(ie,np1,k,igp,jgp));
-
-                if (hvf.process_nh_vars()) {
-                  if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
-                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                    printf ("w_cxx: %3.16f\n",w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                    printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
-                  }
-                  REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
-
-                  if (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]!=phinh_f90(ie,np1,k,igp,jgp)) {
-                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                    printf ("phinh_cxx: %3.16f\n",phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                    printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
-                  }
-                  REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
-                }
+                REQUIRE (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]==v_ref(ie,np1,0,igp,jgp,ilev)[ivec]);
+                REQUIRE (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]==v_ref(ie,np1,1,igp,jgp,ilev)[ivec]);
+                REQUIRE (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]==dp_ref(ie,np1,igp,jgp,ilev)[ivec]);
+                REQUIRE (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]==vtheta_ref(ie,np1,igp,jgp,ilev)[ivec]);
               }
 
               if (hvf.process_nh_vars()) {
-                // Last interface
-                const int k = NUM_INTERFACE_LEV-1;
-                const int ilev = ColInfo<NUM_INTERFACE_LEV>::LastPack;
-                const int ivec = ColInfo<NUM_INTERFACE_LEV>::LastPackEnd;
-
-                if (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]!=phinh_f90(ie,np1,k,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("phinh_cxx: %3.16f\n",phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                  printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
-                }
-                REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
+                for (int k=0; k<NUM_INTERFACE_LEV; ++k) {
+                  const int ilev = k / VECTOR_SIZE;
+                  const int ivec = k % VECTOR_SIZE;
 
-                if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("w_cxx: %3.16f\n",w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                  printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
+                  REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_ref(ie,np1,igp,jgp,ilev)[ivec]);
+                  REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_ref(ie,np1,igp,jgp,ilev)[ivec]);
                 }
-                REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
               }
             }
           }
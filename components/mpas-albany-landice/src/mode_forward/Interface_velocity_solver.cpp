@@ -56,6 +56,12 @@ double rho_ocean;
 int dynamic_ice_bit_value;
 int ice_present_bit_value;
 
+// cached-topology mode: reuse the FE mesh, exchange lists and cell/vertex maps
+// while the masks that define them are unchanged.
+bool reuseMesh = false;
+bool meshReused = false;
+std::vector<char> topologyMasks;
+
 // global variables used for handling logging
 char albany_log_filename[128];
 int original_stdout; // the location of stdout before we captured it
@@ -117,13 +123,14 @@ void velocity_solver_set_parameters(double const* gravity_F, double const* ice_d
                          double const* clausius_clapeyron_coeff,
                          double const* thermal_thickness_limit_F,
                          int const* li_mask_ValueDynamicIce, int const* li_mask_ValueIce,
-                         bool const* use_GLP_F) {
+                         bool const* use_GLP_F, bool const* reuse_mesh_F) {
   // This function sets parameter values used by MPAS on the C/C++ side
   rho_ice = *ice_density_F;
   rho_ocean = *ocean_density_F;
   thermal_thickness_limit = *thermal_thickness_limit_F / unit_length; // Import with Albany scaling
   dynamic_ice_bit_value = *li_mask_ValueDynamicIce;
   ice_present_bit_value = *li_mask_ValueIce;
+  reuseMesh = *reuse_mesh_F;
   velocity_solver_set_physical_parameters__(*gravity_F, rho_ice, *ocean_density_F, *sea_level_F/unit_length, *flowParamA_F*std::pow(unit_length,4)*secondsInAYear, 
                                             *flowLawExponent_F, *dynamic_thickness_F/unit_length, *use_GLP_F, *clausius_clapeyron_coeff);
 }
@@ -333,6 +340,7 @@ void velocity_solver_export_fo_velocity() {
 
 void velocity_solver_finalize() {
   velocity_solver_finalize__();
+  clearExchangePlans();
   delete sendCellsList_F;
   delete recvCellsList_F;
   delete sendEdgesList_F;
@@ -358,6 +366,10 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   verticesMask_F = _verticesMask_F;
   dirichletCellsMask_F = _dirichletCellsMask_F;
 
+  meshReused = reuseMesh && topologyMasksUnchanged();
+  if (meshReused)
+    return;
+
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
   std::vector<int> partialOffset(numProcs + 1), globalOffsetTriangles(
@@ -725,7 +737,8 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
 
 void velocity_solver_extrude_3d_grid(double const* levelsRatio_F) {
 
-  if (isDomainEmpty)
+  //the extruded mesh built at the previous solve is still valid
+  if (isDomainEmpty || meshReused)
     return;
 
   layersRatio.resize(nLayers);
@@ -1009,18 +1022,39 @@ void mapVerticesToCells(const std::vector<double>& velocityOnVertices,
     }
   }
 
-  for (int dim = 0; dim < fieldDim; dim++) {
-    allToAll(&velocityOnCells[dim * nCells_F * (numLayers + 1)],
-        &sendCellsListReversed, &recvCellsListReversed, (numLayers + 1));
-    allToAll(&velocityOnCells[dim * nCells_F * (numLayers + 1)],
-        sendCellsList_F, recvCellsList_F, (numLayers + 1));
-  }
+  // Exchange all the components at once.
+  std::vector<double*> fields(fieldDim);
+  for (int dim = 0; dim < fieldDim; dim++)
+    fields[dim] = &velocityOnCells[dim * nCells_F * (numLayers + 1)];
+  allToAll(fields, &sendCellsListReversed, &recvCellsListReversed, (numLayers + 1));
+  allToAll(fields, sendCellsList_F, recvCellsList_F, (numLayers + 1));
 }
 
 
+//The FE mesh depends on the masks only through the dynamic-ice bit of the
+//vertex and cell masks and through the nonzero pattern of the Dirichlet mask.
+//Returns true if those are the same as at the previous call on every rank.
+bool topologyMasksUnchanged() {
+  std::vector<char> masks;
+  masks.reserve(nVertices_F + nCells_F * (nLayers + 2));
+  for (int i = 0; i < nVertices_F; i++)
+    masks.push_back((verticesMask_F[i] & dynamic_ice_bit_value) != 0);
+  for (int i = 0; i < nCells_F; i++)
+    masks.push_back((cellsMask_F[i] & dynamic_ice_bit_value) != 0);
+  for (int i = 0; i < nCells_F * (nLayers + 1); i++)
+    masks.push_back(dirichletCellsMask_F[i] != 0);
+
+  int unchanged = (masks == topologyMasks), allUnchanged;
+  MPI_Allreduce(&unchanged, &allUnchanged, 1, MPI_INT, MPI_LAND, comm);
+  topologyMasks.swap(masks);
+  return allUnchanged;
+}
+
 void createReverseExchangeLists(exchangeList_Type& sendListReverse_F,
     exchangeList_Type& receiveListReverse_F,
     const std::vector<int>& newProcIds, const int* indexToID_F, exchangeList_Type const * recvList_F) {
+  // Plans built on the old lists refer to their entries.
+  clearExchangePlans();
   sendListReverse_F.clear();
   receiveListReverse_F.clear();
   std::map<int, std::map<int, int> > sendMap, receiveMap;
@@ -1527,44 +1561,121 @@ void allToAll(std::vector<int>& field, exchangeList_Type const * sendList,
 
 void allToAll(double* field, exchangeList_Type const * sendList,
     exchangeList_Type const * recvList, int fieldDim) {
-  int me;
-  MPI_Comm_rank(comm, &me);
-
-  for (int iComp = 0; iComp < fieldDim; iComp++) {
-    exchangeList_Type::const_iterator it;
+  allToAll(std::vector<double*>(1, field), sendList, recvList, fieldDim);
+}
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
+// Packed halo exchange of several fields with fieldDim components each. All
+// the components of all the fields go in one message per neighbor. The pack
+// buffers and the persistent requests (MPI_Send_init/MPI_Recv_init) are
+// built the first time a (sendList, recvList, nFields, fieldDim) combination
+// is used and are reused until the exchange lists change.
+namespace {
+
+struct exchangePlan {
+  struct neighbor {
+    exchange const* ex;
+    std::vector<double> buffer;
+    MPI_Request req;
+  };
+  std::vector<neighbor> sends, recvs;
+  std::vector<MPI_Request> reqs;
+  int nFields, fieldDim;
+
+  exchangePlan(exchangeList_Type const* sendList,
+      exchangeList_Type const* recvList, int _nFields, int _fieldDim) :
+      nFields(_nFields), fieldDim(_fieldDim) {
+    int me;
+    MPI_Comm_rank(comm, &me);
+    const int chunk = nFields * fieldDim;
+    for (auto it = recvList->begin(); it != recvList->end(); ++it) {
       if (it->procID == me)
         continue;
-      MPI_Irecv(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, it->procID, comm, &it->reqID);
+      recvs.push_back(neighbor());
+      neighbor& n = recvs.back();
+      n.ex = &*it;
+      n.buffer.resize(chunk * it->vec.size());
     }
-
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
+    for (auto it = sendList->begin(); it != sendList->end(); ++it) {
       if (it->procID == me)
         continue;
-      for (ID i = 0; i < it->vec.size(); i++)
-        it->doubleBuffer[i] = field[fieldDim * it->vec[i] + iComp];
-
-      MPI_Isend(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, me, comm, &it->reqID);
+      sends.push_back(neighbor());
+      neighbor& n = sends.back();
+      n.ex = &*it;
+      n.buffer.resize(chunk * it->vec.size());
+    }
+    // The buffers don't move from here on, so the requests can be bound to
+    // them.
+    for (auto& n : recvs) {
+      MPI_Recv_init(n.buffer.data(), n.buffer.size(), MPI_DOUBLE, n.ex->procID,
+          n.ex->procID, comm, &n.req);
+      reqs.push_back(n.req);
+    }
+    for (auto& n : sends) {
+      MPI_Send_init(n.buffer.data(), n.buffer.size(), MPI_DOUBLE, n.ex->procID,
+          me, comm, &n.req);
+      reqs.push_back(n.req);
     }
+  }
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+  ~exchangePlan() {
+    for (auto& r : reqs)
+      MPI_Request_free(&r);
+  }
 
-      for (int i = 0; i < int(it->vec.size()); i++)
-        field[fieldDim * it->vec[i] + iComp] = it->doubleBuffer[i];
+  void run(const std::vector<double*>& fields) {
+    const std::size_t nRecvs = recvs.size();
+    if (nRecvs > 0)
+      MPI_Startall(nRecvs, reqs.data());
+    for (std::size_t k = 0; k < sends.size(); ++k) {
+      neighbor& n = sends[k];
+      double* buf = n.buffer.data();
+      for (ID i = 0; i < n.ex->vec.size(); i++) {
+        const int os = fieldDim * n.ex->vec[i];
+        for (int iField = 0; iField < nFields; iField++) {
+          const double* src = fields[iField] + os;
+          for (int iComp = 0; iComp < fieldDim; iComp++)
+            *buf++ = src[iComp];
+        }
+      }
+      MPI_Start(&reqs[nRecvs + k]);
     }
-
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+    // Unpack messages in the order they arrive.
+    for (std::size_t k = 0; k < nRecvs; ++k) {
+      int idx;
+      MPI_Waitany(nRecvs, reqs.data(), &idx, MPI_STATUS_IGNORE);
+      const neighbor& n = recvs[idx];
+      const double* buf = n.buffer.data();
+      for (ID i = 0; i < n.ex->vec.size(); i++) {
+        const int os = fieldDim * n.ex->vec[i];
+        for (int iField = 0; iField < nFields; iField++) {
+          double* dst = fields[iField] + os;
+          for (int iComp = 0; iComp < fieldDim; iComp++)
+            dst[iComp] = *buf++;
+        }
+      }
     }
+    if (!sends.empty())
+      MPI_Waitall(sends.size(), reqs.data() + nRecvs, MPI_STATUSES_IGNORE);
   }
+};
+
+typedef std::tuple<exchangeList_Type const*, exchangeList_Type const*, int, int> exchangePlanKey;
+std::map<exchangePlanKey, std::unique_ptr<exchangePlan> > exchangePlans;
+
+}
+
+void allToAll(const std::vector<double*>& fields,
+    exchangeList_Type const * sendList, exchangeList_Type const * recvList,
+    int fieldDim) {
+  const int nFields = fields.size();
+  auto& plan = exchangePlans[exchangePlanKey(sendList, recvList, nFields, fieldDim)];
+  if (!plan)
+    plan.reset(new exchangePlan(sendList, recvList, nFields, fieldDim));
+  plan->run(fields);
+}
+
+void clearExchangePlans() {
+  exchangePlans.clear();
 }
 
 int initialize_iceProblem(int nTriangles) {
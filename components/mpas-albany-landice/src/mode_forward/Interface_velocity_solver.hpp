@@ -21,6 +21,8 @@ distributed with this code, or at http://mpas-dev.github.io/license.html
 #include <limits>
 #include <cmath>
 #include <map>
+#include <memory>
+#include <tuple>
 
 #ifndef MPASLI_EXTERNAL_INTERFACE_DISABLE_MANGLING
 #define velocity_solver_init_mpi velocity_solver_init_mpi_
@@ -76,7 +78,7 @@ void velocity_solver_set_parameters(double const* gravity_F, double const* ice_d
                         double const* clausius_clapeyron_coeff,
                         double const* thermal_thickness_limit_F,
                         int const* li_mask_ValueDynamicIce, int const* li_mask_ValueIce,
-                        bool const* use_GLP_F);
+                        bool const* use_GLP_F, bool const* reuse_mesh_F);
 
 void velocity_solver_init_l1l2(double const* levelsRatio);
 
@@ -262,8 +264,17 @@ void allToAll(std::vector<int>& field, exchangeList_Type const* sendList,
 void allToAll(double* field, exchangeList_Type const* sendList,
     exchangeList_Type const* recvList, int fieldDim = 1);
 
+//exchanges several fields, each with fieldDim components, in one message per neighbor.
+void allToAll(const std::vector<double*>& fields, exchangeList_Type const* sendList,
+    exchangeList_Type const* recvList, int fieldDim = 1);
+
+//frees the persistent exchange plans; needed whenever the exchange lists change.
+void clearExchangePlans();
+
 void procsSharingVertex(const int vertex, std::vector<int>& procIds);
 
+bool topologyMasksUnchanged();
+
 bool belongToTria(double const* x, double const* t, double bcoords[3], double eps = 1e-3);
 
 